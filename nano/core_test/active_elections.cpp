@@ -1480,3 +1480,34 @@ TEST (active_elections, broadcast_block_on_activation)
 	ASSERT_TIMELY (5s, node1->active.active (send1->qualified_root ()));
 	ASSERT_TIMELY (5s, node2->block_or_pruned_exists (send1->hash ()));
 }
+
+// Elections are only processed by the request loop when they have an action due, not on every iteration
+TEST (active_elections, process_due_elections)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.backlog_population.enable = false;
+	auto & node = *system.add_node (config);
+
+	auto blocks = nano::test::setup_independent_blocks (system, node, 8);
+	ASSERT_TRUE (nano::test::start_elections (system, node, blocks));
+	// No voting representatives in the wallet, elections stay unconfirmed
+	ASSERT_TIMELY (5s, std::all_of (blocks.begin (), blocks.end (), [&node] (auto const & block) {
+		auto election = node.active.election (block->qualified_root ());
+		return election && election->state () == nano::election_state::active;
+	}));
+
+	auto const loops = node.stats.count (nano::stat::type::active, nano::stat::detail::loop);
+	auto const processed = node.stats.count (nano::stat::type::active, nano::stat::detail::processed);
+	ASSERT_TIMELY (5s, node.stats.count (nano::stat::type::active, nano::stat::detail::loop) >= loops + 50);
+	auto const loops_delta = node.stats.count (nano::stat::type::active, nano::stat::detail::loop) - loops;
+	auto const processed_delta = node.stats.count (nano::stat::type::active, nano::stat::detail::processed) - processed;
+	ASSERT_GT (processed_delta, 0);
+	ASSERT_LT (processed_delta, loops_delta * blocks.size () / 2);
+
+	// Confirmed elections are cleaned up
+	auto election = node.active.election (blocks.front ()->qualified_root ());
+	ASSERT_NE (nullptr, election);
+	election->force_confirm ();
+	ASSERT_TIMELY (5s, !node.active.active (*blocks.front ()));
+}
@@ -439,8 +439,8 @@ TEST (block_store, empty_bootstrap)
 {
 	nano::test::system system{};
 	nano::logger logger;
-	unsigned max_unchecked_blocks = 65536;
-	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	std::size_t max_unchecked_memory = 32 * 1024 * 1024;
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
 	size_t count = 0;
 	unchecked.for_each ([&count] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
 		++count;
@@ -1431,6 +1431,46 @@ TEST (mdb_block_store, upgrade_v23_v24)
 	// Testing the upgrade code worked
 	check_correct_state ();
 }
+
+TEST (mdb_block_store, upgrade_v24_v25)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in RocksDB mode
+		GTEST_SKIP ();
+	}
+
+	auto path (nano::unique_path () / "data.ldb");
+	nano::logger logger;
+	nano::account const account1{ 1 }; // Partially cemented
+	nano::account const account2{ 2 }; // Fully cemented
+	nano::account const account3{ 3 }; // Without confirmation height
+
+	// Setting the database to its 24th version state, without the unconfirmed index
+	{
+		nano::store::lmdb::component store (logger, path, nano::dev::constants);
+		auto transaction (store.tx_begin_write ());
+		nano::account_info info{};
+		info.block_count = 3;
+		store.account.put (transaction, account1, info);
+		store.confirmation_height.put (transaction, account1, { 1, nano::block_hash{ 1 } });
+		store.account.put (transaction, account2, info);
+		store.confirmation_height.put (transaction, account2, { 3, nano::block_hash{ 2 } });
+		store.account.put (transaction, account3, info);
+		store.unconfirmed.clear (transaction);
+		store.version.put (transaction, 24);
+		ASSERT_EQ (store.version.get (transaction), 24);
+	}
+
+	// Testing the upgrade code indexed accounts below their block count
+	nano::store::lmdb::component store (logger, path, nano::dev::constants);
+	auto transaction (store.tx_begin_read ());
+	ASSERT_EQ (store.version.get (transaction), store.version_current);
+	ASSERT_TRUE (store.unconfirmed.exists (transaction, account1));
+	ASSERT_TRUE (store.unconfirmed.exists (transaction, account3));
+	ASSERT_FALSE (store.unconfirmed.exists (transaction, account2));
+	ASSERT_EQ (2, store.unconfirmed.count (transaction));
+}
 }
 
 namespace nano::store::rocksdb
@@ -1478,6 +1518,46 @@ TEST (rocksdb_block_store, upgrade_v21_v22)
 	// Testing the upgrade code worked
 	check_correct_state ();
 }
+
+TEST (rocksdb_block_store, upgrade_v24_v25)
+{
+	if (!nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in LMDB mode
+		GTEST_SKIP ();
+	}
+
+	auto const path = nano::unique_path () / "rocksdb";
+	nano::logger logger;
+	nano::account const account1{ 1 }; // Partially cemented
+	nano::account const account2{ 2 }; // Fully cemented
+	nano::account const account3{ 3 }; // Without confirmation height
+
+	// Setting the database to its 24th version state, without the unconfirmed index
+	{
+		nano::store::rocksdb::component store (logger, path, nano::dev::constants);
+		auto transaction (store.tx_begin_write ());
+		nano::account_info info{};
+		info.block_count = 3;
+		store.account.put (transaction, account1, info);
+		store.confirmation_height.put (transaction, account1, { 1, nano::block_hash{ 1 } });
+		store.account.put (transaction, account2, info);
+		store.confirmation_height.put (transaction, account2, { 3, nano::block_hash{ 2 } });
+		store.account.put (transaction, account3, info);
+		store.unconfirmed.clear (transaction);
+		store.version.put (transaction, 24);
+		ASSERT_EQ (store.version.get (transaction), 24);
+	}
+
+	// Testing the upgrade code indexed accounts below their block count
+	nano::store::rocksdb::component store (logger, path, nano::dev::constants);
+	auto transaction (store.tx_begin_read ());
+	ASSERT_EQ (store.version.get (transaction), store.version_current);
+	ASSERT_TRUE (store.unconfirmed.exists (transaction, account1));
+	ASSERT_TRUE (store.unconfirmed.exists (transaction, account3));
+	ASSERT_FALSE (store.unconfirmed.exists (transaction, account2));
+	ASSERT_EQ (2, store.unconfirmed.count (transaction));
+}
 }
 
 // Tests that the new rep_weight table gets filled with all
@@ -555,4 +555,148 @@ TEST (bootstrap_ascending, frontier_scan_cannot_prioritize)
 	ASSERT_ALWAYS (1s, std::none_of (opens2.begin (), opens2.end (), [&node1] (auto const & block) {
 		return node1.ascendboot.prioritized (block->account ());
 	}));
-}
\ No newline at end of file
+}
+
+/*
+ * Tests that the request window of a peer grows while its replies stay fast and shrinks on growing latency and timeouts
+ */
+TEST (bootstrap_ascending, peer_scoring_window)
+{
+	nano::test::system system{ 1 };
+	auto & node = *system.nodes[0];
+	nano::bootstrap_ascending_config config;
+	nano::bootstrap_ascending::peer_scoring scoring{ config, nano::dev::network_params.network, system.stats };
+	auto fast = nano::test::fake_channel (node);
+	auto slow = nano::test::fake_channel (node);
+
+	// Replies arriving close to the lowest observed latency grow the window up to the channel limit
+	for (int i = 0; i < 100; ++i)
+	{
+		ASSERT_FALSE (scoring.try_send_message (fast));
+		scoring.received_message (fast, 10ms, 128);
+	}
+
+	// Growing latency shrinks the window and timeouts halve it
+	ASSERT_FALSE (scoring.try_send_message (slow));
+	scoring.received_message (slow, 10ms, 128);
+	for (int i = 0; i < 20; ++i)
+	{
+		ASSERT_FALSE (scoring.try_send_message (slow));
+		scoring.received_message (slow, 100ms, 128);
+	}
+	ASSERT_FALSE (scoring.try_send_message (slow));
+	scoring.timeout_message (slow);
+	ASSERT_EQ (1, system.stats.count (nano::stat::type::bootstrap_ascending_peers, nano::stat::detail::timeout));
+
+	auto peers = scoring.peers ();
+	ASSERT_EQ (2, peers.size ());
+	for (auto const & peer : peers)
+	{
+		ASSERT_EQ (0, peer.outstanding);
+		if (peer.channel == fast)
+		{
+			ASSERT_EQ (config.channel_limit, peer.window);
+			ASSERT_EQ (10ms, peer.rtt);
+		}
+		else
+		{
+			ASSERT_EQ (nano::bootstrap_ascending::peer_scoring::min_window, peer.window);
+			ASSERT_EQ (1, peer.timeout_count_total);
+		}
+	}
+
+	// Requests are spread according to window sizes
+	std::map<std::shared_ptr<nano::transport::channel>, std::size_t> requests;
+	while (auto channel = scoring.channel ())
+	{
+		++requests[channel];
+	}
+	ASSERT_EQ (config.channel_limit, requests[fast]);
+	ASSERT_EQ (1, requests[slow]);
+}
+
+/*
+ * Tests that a long chain returning full pages is fetched with pipelined requests
+ */
+TEST (bootstrap_ascending, pipeline)
+{
+	nano::test::system system;
+	nano::node_flags flags;
+	flags.disable_legacy_bootstrap = true;
+	auto & node0 = *system.add_node (flags);
+	auto blocks = nano::test::setup_chain (system, node0, 64);
+
+	auto config = system.default_config ();
+	config.bootstrap_ascending.max_pull_count = 4;
+	auto & node1 = *system.add_node (config, flags);
+
+	ASSERT_TIMELY (20s, node1.block (blocks.back ()->hash ()) != nullptr);
+	ASSERT_GT (node1.stats.count (nano::stat::type::bootstrap_ascending, nano::stat::detail::pipeline), 0);
+	ASSERT_EQ (0, node1.ascendboot.staged_size ());
+}
+
+namespace nano
+{
+/*
+ * Pages submitted while block processor is saturated are staged, flushed in order once there is room and dropped when staging is full
+ */
+TEST (bootstrap_ascending, staging)
+{
+	nano::test::system system;
+	nano::node_flags flags;
+	flags.disable_legacy_bootstrap = true;
+	// Service threads would otherwise flush staged blocks on their own
+	flags.disable_ascending_bootstrap = true;
+	auto config = system.default_config ();
+	// Block processor is treated as saturated regardless of its size
+	config.bootstrap_ascending.block_processor_threshold = 0;
+	config.bootstrap_ascending.max_staged_blocks = 4;
+	auto & node = *system.add_node (config, flags);
+
+	auto latest = nano::dev::genesis->hash ();
+	auto balance = nano::dev::constants.genesis_amount;
+	std::deque<std::shared_ptr<nano::block>> blocks;
+	for (int n = 0; n < 5; ++n)
+	{
+		nano::keypair key;
+		nano::block_builder builder;
+		balance -= 1;
+		auto send = builder
+					.state ()
+					.account (nano::dev::genesis_key.pub)
+					.previous (latest)
+					.representative (nano::dev::genesis_key.pub)
+					.balance (balance)
+					.link (key.pub)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*system.work.generate (latest))
+					.build ();
+		latest = send->hash ();
+		blocks.push_back (send);
+	}
+
+	auto & service = node.ascendboot;
+	ASSERT_TRUE (service.submit (nano::dev::genesis_key.pub, { blocks[0], blocks[1] }));
+	ASSERT_TRUE (service.submit (nano::dev::genesis_key.pub, { blocks[2], blocks[3] }));
+	ASSERT_EQ (4, service.staged_size ());
+	ASSERT_EQ (4, node.stats.count (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged));
+	ASSERT_EQ (0, node.block_processor.size ());
+
+	// Staging is full, the page is dropped
+	ASSERT_FALSE (service.submit (nano::dev::genesis_key.pub, { blocks[4] }));
+	ASSERT_EQ (4, service.staged_size ());
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged_dropped));
+
+	// Nothing is flushed while block processor remains saturated
+	ASSERT_TRUE (service.flush_staged ());
+	ASSERT_EQ (4, service.staged_size ());
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged_flushed));
+
+	node.config.bootstrap_ascending.block_processor_threshold = 1000;
+	ASSERT_FALSE (service.flush_staged ());
+	ASSERT_EQ (0, service.staged_size ());
+	ASSERT_EQ (4, node.stats.count (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged_flushed));
+	ASSERT_TIMELY (5s, node.block (blocks[3]->hash ()) != nullptr);
+	ASSERT_EQ (nullptr, node.block (blocks[4]->hash ()));
+}
+}
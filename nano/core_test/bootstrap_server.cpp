@@ -336,6 +336,61 @@ TEST (bootstrap_server, serve_multiple)
 	ASSERT_ALWAYS (1s, responses.size () == chains.size ());
 }
 
+/*
+ * Repeated requests are served from the response cache, as long as the cached chain still matches the ledger
+ */
+TEST (bootstrap_server, serve_cached)
+{
+	nano::test::system system{};
+	auto & node = *system.add_node ();
+
+	responses_helper responses;
+	responses.connect (node.bootstrap_server);
+
+	auto blocks = nano::test::setup_chain (system, node, 4);
+
+	auto send_request = [&] (nano::asc_pull_req::id_t id) {
+		nano::asc_pull_req request{ node.network_params.network };
+		request.id = id;
+		request.type = nano::asc_pull_type::blocks;
+
+		nano::asc_pull_req::blocks_payload request_payload{};
+		request_payload.start = nano::dev::genesis_key.pub;
+		request_payload.count = nano::bootstrap_server::max_blocks;
+		request_payload.start_type = nano::asc_pull_req::hash_type::account;
+
+		request.payload = request_payload;
+		request.update_header ();
+
+		node.network.inbound (request, nano::test::fake_channel (node));
+	};
+
+	auto response_blocks = [&] (std::size_t index) {
+		auto response = responses.get ()[index];
+		return std::get<nano::asc_pull_ack::blocks_payload> (response.payload).blocks;
+	};
+
+	send_request (1);
+	ASSERT_TIMELY_EQ (5s, responses.size (), 1);
+	ASSERT_EQ (response_blocks (0).size (), 5); // Genesis + 4 sends
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::bootstrap_server, nano::stat::detail::cache_hit));
+
+	send_request (2);
+	ASSERT_TIMELY_EQ (5s, responses.size (), 2);
+	ASSERT_EQ (2, responses.get ()[1].id);
+	ASSERT_EQ (response_blocks (1).size (), 5);
+	ASSERT_TRUE (compare_blocks (response_blocks (1), response_blocks (0)));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::bootstrap_server, nano::stat::detail::cache_hit));
+
+	// Extending the chain invalidates the partial response
+	auto extra = nano::test::setup_chain (system, node, 1);
+	send_request (3);
+	ASSERT_TIMELY_EQ (5s, responses.size (), 3);
+	ASSERT_EQ (response_blocks (2).size (), 6);
+	ASSERT_EQ (*response_blocks (2).back (), *extra.front ());
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::bootstrap_server, nano::stat::detail::cache_stale));
+}
+
 TEST (bootstrap_server, serve_account_info)
 {
 	nano::test::system system{};
@@ -1,6 +1,13 @@
+#include <nano/lib/blocks.hpp>
 #include <nano/lib/cli.hpp>
+#include <nano/lib/logging.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/lib/work.hpp>
 #include <nano/node/cli.hpp>
+#include <nano/node/make_store.hpp>
+#include <nano/secure/ledger.hpp>
 #include <nano/secure/utility.hpp>
+#include <nano/store/component.hpp>
 #include <nano/test_common/testutil.hpp>
 
 #include <gtest/gtest.h>
@@ -69,6 +76,56 @@ TEST (cli, config_override_parsing)
 	ASSERT_EQ (config_overrides.size (), 4);
 }
 
+// Clearing the confirmation height of an account also updates the persisted cemented count, which is trusted at startup
+TEST (cli, confirmation_height_clear_account)
+{
+	auto path = nano::unique_path ();
+	nano::logger logger;
+	nano::keypair key;
+	{
+		auto store = nano::make_store (logger, path, nano::dev::constants);
+		nano::stats stats{ logger };
+		nano::ledger ledger{ *store, stats, nano::dev::constants };
+		nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+		nano::block_builder builder;
+		auto send = builder.state ()
+					.account (nano::dev::genesis_key.pub)
+					.previous (nano::dev::genesis->hash ())
+					.representative (nano::dev::genesis_key.pub)
+					.balance (nano::dev::constants.genesis_amount - 1)
+					.link (key.pub)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*pool.generate (nano::dev::genesis->hash ()))
+					.build ();
+		auto open = builder.state ()
+					.account (key.pub)
+					.previous (0)
+					.representative (key.pub)
+					.balance (1)
+					.link (send->hash ())
+					.sign (key.prv, key.pub)
+					.work (*pool.generate (key.pub))
+					.build ();
+		auto transaction = ledger.tx_begin_write ();
+		store->initialize (transaction, ledger.cache, ledger.constants);
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send));
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, open));
+		ledger.confirm (transaction, open->hash ());
+		ASSERT_EQ (3, ledger.cemented_count ());
+	}
+
+	boost::program_options::variables_map vm;
+	vm.emplace ("confirmation_height_clear", boost::program_options::variable_value ());
+	vm.emplace ("account", boost::program_options::variable_value (key.pub.to_account (), false));
+	vm.emplace ("data_path", boost::program_options::variable_value (path.string (), false));
+	call_cli_command (vm);
+
+	auto store = nano::make_store (logger, path, nano::dev::constants);
+	nano::stats stats{ logger };
+	nano::ledger ledger{ *store, stats, nano::dev::constants };
+	ASSERT_EQ (2, ledger.cemented_count ());
+}
+
 namespace
 {
 std::string call_cli_command (boost::program_options::variables_map const & vm)
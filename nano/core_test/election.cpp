@@ -261,8 +261,11 @@ TEST (election, quorum_minimum_update_weight_before_quorum_checks)
 	ASSERT_FALSE (election->confirmed ());
 	{
 		nano::lock_guard<nano::mutex> guard (node1.online_reps.mutex);
-		// Modify online_m for online_reps to more than is available, this checks that voting below updates it to current online reps.
-		node1.online_reps.online_m = node_config.online_weight_minimum.number () + 20;
+		// Count key1 as online with more weight than it has now, this checks that voting below refreshes its weight before quorum checks.
+		auto const stale_weight = node_config.online_weight_minimum.number () + 20;
+		node1.online_reps.reps.insert ({ std::chrono::steady_clock::now (), key1.pub, stale_weight });
+		node1.online_reps.online_m += stale_weight;
+		node1.online_reps.update ();
 	}
 	ASSERT_EQ (nano::vote_code::vote, node1.vote_router.vote (vote2).at (send1->hash ()));
 	ASSERT_TIMELY (5s, election->confirmed ());
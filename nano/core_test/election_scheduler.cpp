@@ -250,6 +250,34 @@ TEST (election_scheduler, no_vacancy)
 	ASSERT_TRUE (node.scheduler.priority.empty ());
 }
 
+TEST (election_scheduler, activate_many)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.backlog_population.enable = false;
+	auto & node = *system.add_node (config);
+
+	nano::state_block_builder builder;
+	nano::keypair key;
+	auto send1 = builder.make_block ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - nano::Gxrb_ratio)
+				 .link (key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	node.ledger.process (node.ledger.tx_begin_write (), send1);
+
+	// Unknown, duplicate and fully confirmed accounts are skipped
+	nano::keypair unknown;
+	auto activated = node.scheduler.priority.activate_many (node.ledger.tx_begin_read (), { unknown.pub, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub });
+	ASSERT_EQ (1, activated);
+	ASSERT_TIMELY (5s, node.active.election (send1->qualified_root ()));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::election_scheduler, nano::stat::detail::activate_skip));
+}
+
 TEST (election_scheduler_bucket, construction)
 {
 	nano::test::system system;
@@ -330,4 +358,27 @@ TEST (election_scheduler_bucket, max_blocks)
 	// Ensure correct order
 	ASSERT_EQ (blocks[0], block1 ());
 	ASSERT_EQ (blocks[1], block0 ());
-}
\ No newline at end of file
+}
+
+TEST (election_scheduler_bucket, insert_batch)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+
+	nano::scheduler::priority_bucket_config bucket_config{
+		.max_blocks = 3
+	};
+	nano::scheduler::bucket bucket{ 0, bucket_config, node.active, node.stats };
+	ASSERT_TRUE (bucket.push (1000, block0 ()));
+	auto added = bucket.push ({ { 1000, block0 () }, { 900, block1 () }, { 1001, block2 () }, { 3000, block3 () } });
+	ASSERT_EQ (4, added.size ());
+	ASSERT_FALSE (added[0]); // Duplicate
+	ASSERT_TRUE (added[1]);
+	ASSERT_TRUE (added[2]);
+	ASSERT_FALSE (added[3]); // Over capacity with lowest priority
+	ASSERT_EQ (3, bucket.size ());
+	auto blocks = bucket.blocks ();
+	ASSERT_EQ (blocks[0], block1 ());
+	ASSERT_EQ (blocks[1], block0 ());
+	ASSERT_EQ (blocks[2], block2 ());
+}
@@ -12,7 +12,10 @@
 #include <nano/node/vote_router.hpp>
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
+#include <nano/store/counters.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/snapshot.hpp>
+#include <nano/store/unconfirmed.hpp>
 #include <nano/test_common/ledger_context.hpp>
 #include <nano/test_common/make_store.hpp>
 #include <nano/test_common/system.hpp>
@@ -20,6 +23,7 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <limits>
 
 using namespace std::chrono_literals;
@@ -4866,6 +4870,102 @@ TEST (ledger, cache)
 	}
 }
 
+TEST (ledger, counters_persisted)
+{
+	auto ctx = nano::test::ledger_send_receive ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto check_counts = [&] () {
+		auto counts = store.counters.get (store.tx_begin_read ());
+		ASSERT_TRUE (counts);
+		ASSERT_EQ (ledger.block_count (), counts->block_count);
+		ASSERT_EQ (ledger.account_count (), counts->account_count);
+		ASSERT_EQ (ledger.cemented_count (), counts->cemented_count);
+	};
+	ASSERT_EQ (3, ledger.block_count ());
+	check_counts ();
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_FALSE (ledger.rollback (transaction, ctx.blocks ()[1]->hash ()));
+	}
+	ASSERT_EQ (2, ledger.block_count ());
+	check_counts ();
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ledger.confirm (transaction, ctx.blocks ()[0]->hash ());
+	}
+	ASSERT_EQ (2, ledger.cemented_count ());
+	check_counts ();
+
+	// Reloading uses the persisted counters
+	nano::ledger ledger2{ store, ctx.stats (), nano::dev::constants };
+	ASSERT_EQ (2, ledger2.block_count ());
+	ASSERT_EQ (1, ledger2.account_count ());
+	ASSERT_EQ (2, ledger2.cemented_count ());
+}
+
+TEST (ledger, verify_counts)
+{
+	auto ctx = nano::test::ledger_send_receive ();
+	auto & store = ctx.store ();
+	auto & stats = ctx.stats ();
+	ASSERT_TRUE (ctx.ledger ().verify_counts ());
+	ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::counters_verified));
+
+	// Corrupt the stored counters, a ledger loaded from them picks up the wrong values
+	{
+		auto transaction = store.tx_begin_write ({ nano::tables::meta });
+		store.counters.put (transaction, { 100, 100, 100 });
+	}
+	nano::ledger ledger{ store, stats, nano::dev::constants };
+	ASSERT_EQ (100, ledger.block_count ());
+
+	ASSERT_FALSE (ledger.verify_counts ());
+	ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::counters_mismatch));
+	ASSERT_EQ (3, ledger.block_count ());
+	ASSERT_EQ (1, ledger.account_count ());
+	ASSERT_EQ (1, ledger.cemented_count ());
+	auto counts = store.counters.get (store.tx_begin_read ());
+	ASSERT_TRUE (counts);
+	ASSERT_EQ (3, counts->block_count);
+	ASSERT_TRUE (ledger.verify_counts ());
+}
+
+TEST (ledger, unconfirmed_index)
+{
+	auto ctx = nano::test::ledger_send_receive ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto & blocks = ctx.blocks ();
+	auto indexed = [&] () {
+		return store.unconfirmed.exists (store.tx_begin_read (), nano::dev::genesis_key.pub);
+	};
+	ASSERT_TRUE (indexed ());
+	ASSERT_EQ (1, store.unconfirmed.count (store.tx_begin_read ()));
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_FALSE (ledger.rollback (transaction, blocks[1]->hash ()));
+	}
+	ASSERT_TRUE (indexed ());
+	// Confirming the account frontier removes it from the index
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ledger.confirm (transaction, blocks[0]->hash ());
+	}
+	ASSERT_FALSE (indexed ());
+	ASSERT_EQ (0, store.unconfirmed.count (store.tx_begin_read ()));
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, blocks[1]));
+	}
+	ASSERT_TRUE (indexed ());
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_FALSE (ledger.rollback (transaction, blocks[1]->hash ()));
+	}
+	ASSERT_FALSE (indexed ());
+}
+
 TEST (ledger, pruning_action)
 {
 	nano::logger logger;
@@ -5485,6 +5585,142 @@ TEST (ledger, migrate_lmdb_to_rocksdb)
 	ASSERT_EQ (rocksdb_store.final_vote.get (rocksdb_transaction, nano::root (send->previous ()))[0], nano::block_hash (2));
 }
 
+// Same as above but tables are written into SST files and ingested
+TEST (ledger, migrate_lmdb_to_rocksdb_bulk_ingest)
+{
+	nano::test::system system{};
+	auto path = nano::unique_path ();
+	nano::logger logger;
+	nano::store::lmdb::component store{ logger, path / "data.ldb", nano::dev::constants };
+	nano::ledger ledger{ store, system.stats, nano::dev::constants };
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+
+	std::shared_ptr<nano::block> send = nano::state_block_builder ()
+										.account (nano::dev::genesis_key.pub)
+										.previous (nano::dev::genesis->hash ())
+										.representative (0)
+										.link (nano::account (10))
+										.balance (nano::dev::constants.genesis_amount - 100)
+										.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+										.work (*pool.generate (nano::dev::genesis->hash ()))
+										.build ();
+
+	{
+		auto transaction = ledger.tx_begin_write ();
+		store.initialize (transaction, ledger.cache, ledger.constants);
+		ASSERT_FALSE (store.init_error ());
+
+		store.confirmation_height.put (transaction, nano::dev::genesis_key.pub, { 2, send->hash () });
+		store.pending.put (transaction, nano::pending_key (nano::dev::genesis_key.pub, send->hash ()), nano::pending_info (nano::dev::genesis_key.pub, 100, nano::epoch::epoch_0));
+		store.pruned.put (transaction, send->hash ());
+		send->sideband_set ({});
+		store.block.put (transaction, send->hash (), *send);
+		store.final_vote.put (transaction, send->qualified_root (), nano::block_hash (2));
+		store.unconfirmed.put (transaction, nano::dev::genesis_key.pub);
+	}
+
+	auto error = ledger.migrate_lmdb_to_rocksdb (path, true);
+	ASSERT_FALSE (error);
+	ASSERT_FALSE (std::filesystem::exists (path / "rocksdb_ingest"));
+
+	nano::store::rocksdb::component rocksdb_store{ logger, path / "rocksdb", nano::dev::constants };
+	auto rocksdb_transaction (rocksdb_store.tx_begin_read ());
+
+	ASSERT_EQ (rocksdb_store.block.count (rocksdb_transaction), 2);
+	ASSERT_EQ (*send, *rocksdb_store.block.get (rocksdb_transaction, send->hash ()));
+	ASSERT_EQ (*nano::dev::genesis, *rocksdb_store.block.get (rocksdb_transaction, nano::dev::genesis->hash ()));
+	ASSERT_TRUE (rocksdb_store.account.get (rocksdb_transaction, nano::dev::genesis_key.pub));
+	ASSERT_TRUE (rocksdb_store.pending.get (rocksdb_transaction, nano::pending_key (nano::dev::genesis_key.pub, send->hash ())));
+	ASSERT_TRUE (rocksdb_store.pruned.exists (rocksdb_transaction, send->hash ()));
+	ASSERT_TRUE (rocksdb_store.unconfirmed.exists (rocksdb_transaction, nano::dev::genesis_key.pub));
+	ASSERT_EQ (rocksdb_store.rep_weight.get (rocksdb_transaction, nano::dev::genesis_key.pub), std::numeric_limits<nano::uint128_t>::max ());
+	nano::confirmation_height_info confirmation_height_info;
+	ASSERT_FALSE (rocksdb_store.confirmation_height.get (rocksdb_transaction, nano::dev::genesis_key.pub, confirmation_height_info));
+	ASSERT_EQ (confirmation_height_info.height, 2);
+	ASSERT_EQ (confirmation_height_info.frontier, send->hash ());
+	ASSERT_EQ (rocksdb_store.final_vote.get (rocksdb_transaction, nano::root (send->previous ()))[0], nano::block_hash (2));
+	ASSERT_EQ (rocksdb_store.version.get (rocksdb_transaction), nano::store::component::version_current);
+}
+
+TEST (ledger, snapshot_export_import)
+{
+	nano::test::system system{};
+	auto path = nano::unique_path ();
+	nano::logger logger;
+	nano::store::lmdb::component store{ logger, path / "data.ldb", nano::dev::constants };
+	nano::ledger ledger{ store, system.stats, nano::dev::constants };
+	nano::work_pool pool{ nano::dev::network_params.network, std::numeric_limits<unsigned>::max () };
+
+	std::shared_ptr<nano::block> send = nano::state_block_builder ()
+										.account (nano::dev::genesis_key.pub)
+										.previous (nano::dev::genesis->hash ())
+										.representative (0)
+										.link (nano::account (10))
+										.balance (nano::dev::constants.genesis_amount - 100)
+										.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+										.work (*pool.generate (nano::dev::genesis->hash ()))
+										.build ();
+
+	{
+		auto transaction = ledger.tx_begin_write ();
+		store.initialize (transaction, ledger.cache, ledger.constants);
+		store.confirmation_height.put (transaction, nano::dev::genesis_key.pub, { 2, send->hash () });
+		store.pending.put (transaction, nano::pending_key (nano::dev::genesis_key.pub, send->hash ()), nano::pending_info (nano::dev::genesis_key.pub, 100, nano::epoch::epoch_0));
+		send->sideband_set ({});
+		store.block.put (transaction, send->hash (), *send);
+		store.final_vote.put (transaction, send->qualified_root (), nano::block_hash (2));
+		store.unconfirmed.put (transaction, nano::dev::genesis_key.pub);
+	}
+
+	auto file = path / "ledger.snapshot";
+	nano::store::snapshot snapshot{ store, logger };
+	ASSERT_FALSE (snapshot.export_to (file, 4));
+
+	// Snapshots are backend independent
+	auto import_path = nano::unique_path ();
+	nano::store::rocksdb::component rocksdb_store{ logger, import_path / "rocksdb", nano::dev::constants };
+	nano::store::snapshot rocksdb_snapshot{ rocksdb_store, logger };
+	ASSERT_FALSE (rocksdb_snapshot.import_from (file));
+	{
+		auto transaction = rocksdb_store.tx_begin_read ();
+		ASSERT_EQ (rocksdb_store.block.count (transaction), 2);
+		ASSERT_EQ (*send, *rocksdb_store.block.get (transaction, send->hash ()));
+		ASSERT_EQ (*nano::dev::genesis, *rocksdb_store.block.get (transaction, nano::dev::genesis->hash ()));
+		ASSERT_TRUE (rocksdb_store.account.get (transaction, nano::dev::genesis_key.pub));
+		ASSERT_TRUE (rocksdb_store.pending.get (transaction, nano::pending_key (nano::dev::genesis_key.pub, send->hash ())));
+		ASSERT_TRUE (rocksdb_store.unconfirmed.exists (transaction, nano::dev::genesis_key.pub));
+		ASSERT_EQ (rocksdb_store.rep_weight.get (transaction, nano::dev::genesis_key.pub), std::numeric_limits<nano::uint128_t>::max ());
+		ASSERT_EQ (rocksdb_store.final_vote.get (transaction, nano::root (send->previous ()))[0], nano::block_hash (2));
+		ASSERT_EQ (rocksdb_store.counters.get (transaction), store.counters.get (store.tx_begin_read ()));
+	}
+
+	// Importing into a populated ledger is refused
+	ASSERT_TRUE (rocksdb_snapshot.import_from (file));
+
+	// Corrupted chunks are detected
+	{
+		std::fstream stream{ file, std::ios::in | std::ios::out | std::ios::binary };
+		stream.seekp (-40, std::ios::end);
+		stream.put (~static_cast<char> (stream.peek ()));
+	}
+	nano::store::lmdb::component corrupt_store{ logger, nano::unique_path () / "data.ldb", nano::dev::constants };
+	nano::store::snapshot corrupt_snapshot{ corrupt_store, logger };
+	ASSERT_TRUE (corrupt_snapshot.import_from (file));
+	// Nothing is loaded from a corrupt snapshot, so the import can be retried
+	{
+		auto transaction = corrupt_store.tx_begin_read ();
+		for (auto table : nano::store::snapshot::tables)
+		{
+			bool empty = true;
+			corrupt_store.raw_for_each (transaction, table, {}, {}, [&empty] (auto, auto) {
+				empty = false;
+				return false;
+			});
+			ASSERT_TRUE (empty);
+		}
+	}
+}
+
 TEST (ledger, is_send_genesis)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -5855,4 +6091,42 @@ TEST (ledger_transaction, write_wait_order)
 
 	// Signal to continue and drop the third transaction
 	latch3.count_down ();
-}
\ No newline at end of file
+}
+
+TEST (ledger, block_filter)
+{
+	nano::test::system system;
+	auto config = system.default_config ();
+	config.block_filter_memory = 64 * 1024;
+	auto & node = *system.add_node (config);
+	auto send = nano::state_block_builder ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.link (nano::account (10))
+				.balance (nano::dev::constants.genesis_amount - 100)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*system.work.generate (nano::dev::genesis->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, node.process (send));
+
+	auto transaction = node.ledger.tx_begin_read ();
+	ASSERT_TRUE (node.ledger.any.block_exists_or_pruned (transaction, nano::dev::genesis->hash ()));
+	ASSERT_TRUE (node.ledger.any.block_exists_or_pruned (transaction, send->hash ()));
+
+	// Nearly all lookups for missing blocks are answered by the filter
+	for (int i = 0; i < 1000; ++i)
+	{
+		nano::block_hash random;
+		nano::random_pool::generate_block (random.bytes.data (), random.bytes.size ());
+		ASSERT_FALSE (node.ledger.any.block_exists_or_pruned (transaction, random));
+	}
+	auto filtered = node.stats.count (nano::stat::type::block_filter, nano::stat::detail::filtered);
+	ASSERT_EQ (1000, filtered + node.stats.count (nano::stat::type::block_filter, nano::stat::detail::false_positive));
+	ASSERT_GT (filtered, 990);
+
+	// Filter is rebuilt from existing blocks on startup
+	nano::ledger ledger{ node.store, system.stats, nano::dev::constants, nano::generate_cache_flags{}, 0, 64 * 1024 };
+	ASSERT_TRUE (ledger.any.block_exists (transaction, send->hash ()));
+	ASSERT_TRUE (ledger.block_maybe_exists (send->hash ()));
+}
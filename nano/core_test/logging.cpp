@@ -1,9 +1,12 @@
 #include <nano/lib/logging.hpp>
+#include <nano/lib/trace_recorder.hpp>
+#include <nano/secure/utility.hpp>
 #include <nano/test_common/testutil.hpp>
 
 #include <gtest/gtest.h>
 
 #include <ostream>
+#include <sstream>
 
 using namespace std::chrono_literals;
 
@@ -59,6 +62,65 @@ TEST (tracing, no_move)
 	logger.trace (nano::log::type::test, nano::log::detail::test, nano::log::arg{ "non_moveable", nm });
 }
 
+TEST (logging, lazy_not_evaluated_when_filtered)
+{
+	nano::logger logger;
+
+	bool evaluated = false;
+	logger.debug (nano::log::type::test, "{}", nano::log::lazy ([&evaluated] () {
+		evaluated = true;
+		return "lazy";
+	}));
+
+	// Default log level for tests is `off`, so the argument should never be formatted
+	ASSERT_FALSE (evaluated);
+}
+
+TEST (trace_recorder, decode)
+{
+	auto path = nano::unique_path ();
+	{
+		nano::log::trace_recorder recorder{ path, 64 * 1024 };
+		auto & os = recorder.begin_event ();
+		os << nano::streamed_args (nano::log::trace_recorder::binary_config (), nano::log::arg{ "number", 123 }, nano::log::arg{ "text", std::string{ "abc" } });
+		recorder.end_event (nano::log::type::test, nano::log::detail::test);
+	}
+
+	std::stringstream ss;
+	nano::log::trace_decoder decoder{ nano::object_stream_config::json_config () };
+	ASSERT_EQ (1, decoder.decode (path / "trace_001.bin", ss));
+
+	auto output = ss.str ();
+	ASSERT_NE (std::string::npos, output.find ("\"event\":\"test::test\""));
+	ASSERT_NE (std::string::npos, output.find ("\"number\":123"));
+	ASSERT_NE (std::string::npos, output.find ("\"text\":\"abc\""));
+}
+
+TEST (trace_recorder, ring_wraparound)
+{
+	auto path = nano::unique_path ();
+	std::size_t const total = 1000;
+	{
+		nano::log::trace_recorder recorder{ path, 4 * 1024 };
+		for (std::size_t i = 0; i < total; ++i)
+		{
+			auto & os = recorder.begin_event ();
+			os << nano::streamed_args (nano::log::trace_recorder::binary_config (), nano::log::arg{ "index", i });
+			recorder.end_event (nano::log::type::test, nano::log::detail::test);
+		}
+	}
+
+	std::stringstream ss;
+	nano::log::trace_decoder decoder{ nano::object_stream_config::json_config () };
+	auto count = decoder.decode (path / "trace_001.bin", ss);
+
+	// Only the most recent events fit in the ring
+	ASSERT_GT (count, 0);
+	ASSERT_LT (count, total);
+	ASSERT_NE (std::string::npos, ss.str ().find (fmt::format ("\"index\":{}", total - 1)));
+	ASSERT_EQ (std::string::npos, ss.str ().find ("\"index\":0\n"));
+}
+
 TEST (log_parse, parse_level)
 {
 	ASSERT_EQ (nano::log::parse_level ("error"), nano::log::level::error);
@@ -88,6 +150,14 @@ TEST (log_parse, parse_detail)
 	ASSERT_THROW (nano::log::parse_detail ("_all"), std::invalid_argument);
 }
 
+TEST (log_parse, parse_overflow_policy)
+{
+	ASSERT_EQ (nano::log::parse_overflow_policy ("block"), nano::log::overflow_policy::block);
+	ASSERT_EQ (nano::log::parse_overflow_policy ("drop"), nano::log::overflow_policy::drop);
+	ASSERT_THROW (nano::log::parse_overflow_policy ("enumnotpresent"), std::invalid_argument);
+	ASSERT_THROW (nano::log::parse_overflow_policy (""), std::invalid_argument);
+}
+
 TEST (log_parse, parse_logger_id)
 {
 	ASSERT_EQ (nano::log::parse_logger_id ("node"), std::make_pair (nano::log::type::node, nano::log::detail::all));
@@ -1,11 +1,16 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/memory.hpp>
+#include <nano/lib/object_pool.hpp>
+#include <nano/lib/stream.hpp>
 #include <nano/node/active_elections.hpp>
 #include <nano/secure/common.hpp>
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <memory>
+#include <set>
+#include <thread>
 #include <vector>
 
 namespace
@@ -88,3 +93,141 @@ TEST (memory_pool, validate_cleanup)
 	ASSERT_EQ (nano::determine_shared_ptr_pool_size<nano::state_block> (), get_allocated_size<nano::state_block> () - sizeof (size_t));
 	ASSERT_EQ (nano::determine_shared_ptr_pool_size<nano::vote> (), get_allocated_size<nano::vote> () - sizeof (size_t));
 }
+
+namespace
+{
+class pooled_object final : public nano::pooled<pooled_object>
+{
+public:
+	explicit pooled_object (uint64_t value_a) :
+		value{ value_a }
+	{
+	}
+	uint64_t value;
+	std::array<uint8_t, 100> padding;
+};
+}
+
+TEST (object_pool, reuse)
+{
+	if (!nano::get_use_memory_pools ())
+	{
+		return;
+	}
+	using stats = nano::object_pool_stats<pooled_object>;
+
+	auto hits = stats::hits.load ();
+	auto misses = stats::misses.load ();
+	std::vector<std::unique_ptr<pooled_object>> objects;
+	for (auto i = 0; i < 10; ++i)
+	{
+		objects.push_back (std::make_unique<pooled_object> (i));
+	}
+	std::set<pooled_object *> addresses;
+	for (auto & object : objects)
+	{
+		addresses.insert (object.get ());
+	}
+	objects.clear ();
+	// Freed blocks are handed out again from the thread cache
+	for (auto i = 0; i < 10; ++i)
+	{
+		objects.push_back (std::make_unique<pooled_object> (i));
+		ASSERT_TRUE (addresses.contains (objects.back ().get ()));
+		ASSERT_EQ (i, objects.back ()->value);
+	}
+	ASSERT_EQ (hits + 10, stats::hits.load ());
+	ASSERT_LE (misses + 10, stats::misses.load ());
+}
+
+TEST (object_pool, make_pooled)
+{
+	if (!nano::get_use_memory_pools ())
+	{
+		return;
+	}
+	using stats = nano::object_pool_stats<nano::state_block>;
+
+	nano::block_builder builder;
+	nano::keypair key;
+	auto block = builder.state ().account (1).previous (2).representative (3).balance (4).link (5).sign (key.prv, key.pub).work (7).build ();
+	std::vector<uint8_t> bytes;
+	{
+		nano::vectorstream stream{ bytes };
+		block->serialize (stream);
+	}
+	auto deserialize = [&bytes] () {
+		nano::bufferstream stream{ bytes.data (), bytes.size () };
+		return nano::deserialize_block (stream, nano::block_type::state);
+	};
+	deserialize (); // Block returns to the thread cache once released
+	auto hits = stats::hits.load ();
+	auto result = deserialize ();
+	ASSERT_NE (nullptr, result);
+	ASSERT_EQ (*block, *result);
+	ASSERT_EQ (hits + 1, stats::hits.load ());
+}
+
+// Blocks released on another thread end up in the shared list once that thread exits and can be reused
+TEST (object_pool, cross_thread)
+{
+	if (!nano::get_use_memory_pools ())
+	{
+		return;
+	}
+	using pool = nano::object_pool<pooled_object>;
+
+	std::vector<void *> blocks;
+	for (auto i = 0; i < 10; ++i)
+	{
+		blocks.push_back (pool::allocate ());
+	}
+	std::thread thread ([&blocks] () {
+		for (auto block : blocks)
+		{
+			pool::deallocate (block);
+		}
+	});
+	thread.join ();
+
+	// Drain this thread's cache, the released blocks are fetched from the shared list afterwards
+	std::set<void *> released{ blocks.begin (), blocks.end () };
+	std::vector<void *> allocated;
+	bool found = false;
+	for (std::size_t i = 0; i < pool::cache_size * 2 && !found; ++i)
+	{
+		allocated.push_back (pool::allocate ());
+		found = released.contains (allocated.back ());
+	}
+	ASSERT_TRUE (found);
+	for (auto block : allocated)
+	{
+		pool::deallocate (block);
+	}
+}
+
+// Free blocks above the shared list limit are returned to the global allocator once a burst is over
+TEST (object_pool, shared_limit)
+{
+	if (!nano::get_use_memory_pools ())
+	{
+		return;
+	}
+	using pool = nano::object_pool<pooled_object>;
+
+	std::thread thread ([] () {
+		std::vector<void *> blocks;
+		for (std::size_t i = 0; i < pool::shared_limit * 4; ++i)
+		{
+			blocks.push_back (pool::allocate ());
+		}
+		for (auto block : blocks)
+		{
+			pool::deallocate (block);
+		}
+	});
+	thread.join ();
+
+	// Without the limit the shared list would hold every block of the burst
+	ASSERT_LE (pool::shared_size (), pool::shared_limit);
+}
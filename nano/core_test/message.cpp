@@ -231,7 +231,7 @@ TEST (message, confirm_ack_hash_serialization)
 	nano::confirm_ack con2 (error, stream2, header);
 	ASSERT_FALSE (error);
 	ASSERT_EQ (con1, con2);
-	ASSERT_EQ (hashes, con2.vote->hashes);
+	ASSERT_EQ (hashes, std::vector<nano::block_hash> (con2.vote->hashes ().begin (), con2.vote->hashes ().end ()));
 	ASSERT_FALSE (header.confirm_is_v2 ());
 	ASSERT_EQ (header.count_get (), hashes.size ());
 	ASSERT_FALSE (con2.is_rebroadcasted ());
@@ -273,7 +273,7 @@ TEST (message, confirm_ack_hash_serialization_v2)
 	nano::confirm_ack con2 (error, stream2, header);
 	ASSERT_FALSE (error);
 	ASSERT_EQ (con1, con2);
-	ASSERT_EQ (hashes, con2.vote->hashes);
+	ASSERT_EQ (hashes, std::vector<nano::block_hash> (con2.vote->hashes ().begin (), con2.vote->hashes ().end ()));
 	ASSERT_TRUE (header.confirm_is_v2 ());
 	ASSERT_EQ (header.count_v2_get (), hashes.size ());
 	ASSERT_FALSE (con2.is_rebroadcasted ());
@@ -296,7 +296,7 @@ TEST (message, confirm_ack_rebroadcasted_flag)
 	nano::confirm_ack con2 (error, stream2, header);
 	ASSERT_FALSE (error);
 	ASSERT_EQ (con1, con2);
-	ASSERT_TRUE (con2.vote->hashes.empty ());
+	ASSERT_TRUE (con2.vote->hashes ().empty ());
 	ASSERT_TRUE (con2.is_rebroadcasted ());
 }
 
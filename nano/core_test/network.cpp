@@ -1,4 +1,6 @@
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/io_shards.hpp>
+#include <nano/node/bandwidth_limiter.hpp>
 #include <nano/node/election.hpp>
 #include <nano/node/network.hpp>
 #include <nano/node/nodeconfig.hpp>
@@ -580,6 +582,40 @@ TEST (tcp_listener, tcp_node_id_handshake)
 	ASSERT_TIMELY (5s, done);
 }
 
+// Connections to and from a node with IO shards are served by the shards and carry messages both ways
+TEST (tcp_listener, io_shards)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.io_shards = 2;
+	auto & node1 = *system.add_node (config);
+	auto & node2 = *system.add_node ();
+	ASSERT_EQ (2, node1.io_shards.size ());
+	ASSERT_TIMELY_EQ (5s, node1.network.size (), 1);
+	ASSERT_TIMELY_EQ (5s, node2.network.size (), 1);
+
+	nano::block_builder builder;
+	auto send1 = builder.send ()
+				 .previous (nano::dev::genesis->hash ())
+				 .destination (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	node2.network.flood_block (send1);
+	ASSERT_TIMELY (5s, node1.block (send1->hash ()));
+
+	auto send2 = builder.send ()
+				 .previous (send1->hash ())
+				 .destination (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 2)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (send1->hash ()))
+				 .build ();
+	node1.network.flood_block (send2);
+	ASSERT_TIMELY (5s, node2.block (send2->hash ()));
+}
+
 // Test disabled because it's failing intermittently.
 // PR in which it got disabled: https://github.com/nanocurrency/nano-node/pull/3611
 // Issue for investigating it: https://github.com/nanocurrency/nano-node/issues/3615
@@ -905,6 +941,95 @@ TEST (network, bandwidth_limiter_with_burst)
 	ASSERT_TIMELY_EQ (1s, 0, node.stats.count (nano::stat::type::drop, nano::stat::detail::publish, nano::stat::dir::out));
 }
 
+// A channel sending more than its share cannot use up the bandwidth of other channels
+TEST (network, bandwidth_limiter_per_channel)
+{
+	nano::test::system system;
+	nano::publish message{ nano::dev::network_params.network, nano::dev::genesis };
+	auto message_size = message.to_bytes ()->size ();
+	auto message_limit = 8;
+	nano::node_config node_config = system.default_config ();
+	node_config.bandwidth_limit = message_limit * message_size;
+	node_config.bandwidth_limit_burst_ratio = 1.0;
+	auto & node = *system.add_node (node_config);
+	nano::transport::inproc::channel channel1{ node, node };
+	nano::transport::inproc::channel channel2{ node, node };
+	channel1.send (message);
+	channel2.send (message);
+	// Each channel has a share of 4 messages, channel1 can send its remaining share while half of the limit stays reserved
+	for (auto i = 0; i < 10; ++i)
+	{
+		channel1.send (message);
+	}
+	ASSERT_TIMELY_EQ (1s, 6, node.stats.count (nano::stat::type::drop, nano::stat::detail::publish, nano::stat::dir::out));
+	// channel2 is still within its share
+	channel2.send (message);
+	channel2.send (message);
+	ASSERT_ALWAYS_EQ (100ms, 6, node.stats.count (nano::stat::type::drop, nano::stat::detail::publish, nano::stat::dir::out));
+	ASSERT_EQ (6 * message_size, node.stats.count (nano::stat::type::bandwidth_limiter, nano::stat::detail::dropped, nano::stat::dir::out));
+}
+
+// Traffic which cannot be dropped by the limiter is not counted as dropped, but still uses up bandwidth
+TEST (network, bandwidth_limiter_no_limiter_drop)
+{
+	nano::test::system system;
+	nano::publish message{ nano::dev::network_params.network, nano::dev::genesis };
+	auto message_size = message.to_bytes ()->size ();
+	auto message_limit = 2;
+	nano::node_config node_config = system.default_config ();
+	node_config.bandwidth_limit = message_limit * message_size;
+	node_config.bandwidth_limit_burst_ratio = 1.0;
+	auto & node = *system.add_node (node_config);
+	nano::transport::inproc::channel channel1{ node, node };
+	nano::transport::inproc::channel channel2{ node, node };
+	for (auto i = 0; i < 4; ++i)
+	{
+		channel1.send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+	}
+	ASSERT_EQ (4 * message_size, node.stats.count (nano::stat::type::bandwidth_limiter, nano::stat::detail::sent, nano::stat::dir::out));
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::bandwidth_limiter, nano::stat::detail::dropped, nano::stat::dir::out));
+	// The limit was used up by channel1
+	channel2.send (message);
+	ASSERT_TIMELY_EQ (1s, 1, node.stats.count (nano::stat::type::drop, nano::stat::detail::publish, nano::stat::dir::out));
+	ASSERT_EQ (message_size, node.stats.count (nano::stat::type::bandwidth_limiter, nano::stat::detail::dropped, nano::stat::dir::out));
+}
+
+// Principal representative channels receive a larger share of the limit
+TEST (network, bandwidth_limiter_principal)
+{
+	nano::test::system system;
+	nano::publish message{ nano::dev::network_params.network, nano::dev::genesis };
+	auto message_size = message.to_bytes ()->size ();
+	auto message_limit = 10;
+	nano::node_config node_config = system.default_config ();
+	node_config.bandwidth_limit = message_limit * message_size;
+	node_config.bandwidth_limit_burst_ratio = 1.0;
+	node_config.bandwidth_limit_pr_share = 4;
+	auto & node = *system.add_node (node_config);
+	auto channel1 = std::make_shared<nano::transport::inproc::channel> (node, node);
+	auto channel2 = std::make_shared<nano::transport::inproc::channel> (node, node);
+	node.outbound_limiter.set_principals ({ channel2 });
+	channel1->send (message);
+	channel2->send (message);
+	// channel1 gets 2 of 10 messages, channel2 gets 8
+	for (auto i = 0; i < 10; ++i)
+	{
+		channel1->send (message);
+	}
+	for (auto i = 0; i < 5; ++i)
+	{
+		channel2->send (message);
+	}
+	auto peers = node.outbound_limiter.peers ();
+	ASSERT_EQ (2, peers.size ());
+	std::sort (peers.begin (), peers.end (), [] (auto const & a, auto const & b) { return a.principal < b.principal; });
+	ASSERT_FALSE (peers[0].principal);
+	ASSERT_GT (peers[0].dropped_bytes, 0);
+	ASSERT_TRUE (peers[1].principal);
+	ASSERT_EQ (6 * message_size, peers[1].sent_bytes);
+	ASSERT_EQ (0, peers[1].dropped_bytes);
+}
+
 namespace nano
 {
 TEST (peer_exclusion, validate)
@@ -1233,3 +1358,29 @@ TEST (network, purge_dead_channel_remote)
 	};
 	ASSERT_TIMELY (5s, !channel_exists (node2, channel));
 }
+
+/*
+ * A message serialized once can be sent to multiple channels, each send is accounted for as a regular message
+ */
+TEST (network, send_serialized)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+	auto channel1 = nano::test::fake_channel (node);
+	auto channel2 = nano::test::fake_channel (node);
+
+	auto vote = nano::test::make_vote (nano::dev::genesis_key, { nano::dev::genesis->hash () });
+	nano::confirm_ack message{ nano::dev::network_params.network, vote };
+	auto const buffer = message.to_shared_const_buffer ();
+
+	std::atomic<std::size_t> sent_size{ 0 };
+	auto callback = [&sent_size] (boost::system::error_code const & ec, std::size_t size) {
+		ASSERT_FALSE (ec);
+		sent_size += size;
+	};
+	channel1->send (buffer, message, callback);
+	channel2->send (buffer, message, callback);
+
+	ASSERT_TIMELY_EQ (5s, 2 * buffer.size (), sent_size);
+	ASSERT_EQ (2, node.stats.count (nano::stat::type::message, nano::stat::detail::confirm_ack, nano::stat::dir::out));
+}
@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 TEST (network_filter, apply)
 {
 	nano::network_filter filter (4);
@@ -163,4 +166,39 @@ TEST (network_filter, expire)
 
 	ASSERT_FALSE (filter.check (2)); // Entry with epoch 1 should be expired
 	ASSERT_FALSE (filter.apply (2)); // Entry with epoch 1 should be replaced
-}
\ No newline at end of file
+}
+
+// Digests applied concurrently from many threads are reported as new exactly once
+TEST (network_filter, concurrent)
+{
+	std::size_t const digest_count = 16 * 1024;
+	std::size_t const thread_count = 8;
+	// Large enough that digests do not evict each other
+	nano::network_filter filter{ digest_count * 2 };
+
+	std::atomic<std::size_t> unique{ 0 };
+	std::vector<std::thread> threads;
+	for (std::size_t n = 0; n < thread_count; ++n)
+	{
+		threads.emplace_back ([&filter, &unique, n, digest_count] () {
+			for (std::size_t i = 0; i < digest_count; ++i)
+			{
+				// Each thread walks the digests from a different offset to maximize overlap
+				nano::network_filter::digest_t digest{ 1 + (i + n * 997) % digest_count };
+				if (!filter.apply (digest))
+				{
+					++unique;
+				}
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+	ASSERT_EQ (digest_count, unique);
+
+	filter.clear ();
+	ASSERT_FALSE (filter.check (1));
+	ASSERT_FALSE (filter.check (digest_count));
+}
@@ -1585,6 +1585,66 @@ TEST (node, online_reps)
 	ASSERT_EQ (node1.config.online_weight_minimum, node1.online_reps.trended ());
 }
 
+TEST (node, online_reps_trend)
+{
+	nano::test::system system (1);
+	auto & node1 (*system.nodes[0]);
+	auto const minimum = node1.config.online_weight_minimum.number ();
+	// Samples: 0, genesis, 0, genesis, genesis
+	for (auto online : { false, true, false, true, true })
+	{
+		node1.online_reps.clear ();
+		if (online)
+		{
+			node1.online_reps.observe (nano::dev::genesis_key.pub);
+		}
+		node1.online_reps.sample ();
+	}
+	// Median of 0, 0, minimum, genesis, genesis, genesis
+	ASSERT_EQ (nano::dev::constants.genesis_amount, node1.online_reps.trended ());
+	ASSERT_EQ (nano::dev::constants.genesis_amount, node1.online_reps.online ());
+	ASSERT_EQ ((nano::uint256_t{ nano::dev::constants.genesis_amount } * nano::online_reps::online_weight_quorum / 100).convert_to<nano::uint128_t> (), node1.online_reps.delta ());
+	node1.online_reps.clear ();
+	node1.online_reps.sample ();
+	// Median of 0, 0, 0, minimum, genesis, genesis, genesis
+	ASSERT_EQ (minimum, node1.online_reps.trended ());
+	node1.online_reps.sample ();
+	// Samples are reloaded when the table changes outside of sampling
+	node1.store.online_weight.clear (node1.store.tx_begin_write ());
+	node1.online_reps.observe (nano::dev::genesis_key.pub);
+	node1.online_reps.sample ();
+	// Median of minimum, genesis
+	ASSERT_EQ (nano::dev::constants.genesis_amount, node1.online_reps.trended ());
+}
+
+// A representative whose weight was delegated away stops counting towards online weight once it votes again
+TEST (node, online_reps_weight_delegated)
+{
+	nano::test::system system (1);
+	auto & node1 (*system.nodes[0]);
+	node1.online_reps.observe (nano::dev::genesis_key.pub);
+	ASSERT_EQ (nano::dev::constants.genesis_amount, node1.online_reps.online ());
+	nano::keypair key;
+	nano::block_builder builder;
+	auto change = builder
+				  .state ()
+				  .account (nano::dev::genesis_key.pub)
+				  .previous (nano::dev::genesis->hash ())
+				  .representative (key.pub)
+				  .balance (nano::dev::constants.genesis_amount)
+				  .link (0)
+				  .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				  .work (*system.work.generate (nano::dev::genesis->hash ()))
+				  .build ();
+	ASSERT_EQ (nano::block_status::progress, node1.process (change));
+	// Recorded weight is kept until the representative is observed again
+	ASSERT_EQ (nano::dev::constants.genesis_amount, node1.online_reps.online ());
+	node1.online_reps.observe (nano::dev::genesis_key.pub);
+	ASSERT_EQ (0, node1.online_reps.online ());
+	node1.online_reps.observe (key.pub);
+	ASSERT_EQ (nano::dev::constants.genesis_amount, node1.online_reps.online ());
+}
+
 TEST (node, online_reps_rep_crawler)
 {
 	nano::test::system system;
@@ -1870,8 +1930,8 @@ TEST (node, DISABLED_local_votes_cache_generate_new_vote)
 	ASSERT_TIMELY (5s, !node.history.votes (nano::dev::genesis->root (), nano::dev::genesis->hash ()).empty ());
 	auto votes1 = node.history.votes (nano::dev::genesis->root (), nano::dev::genesis->hash ());
 	ASSERT_EQ (1, votes1.size ());
-	ASSERT_EQ (1, votes1[0]->hashes.size ());
-	ASSERT_EQ (nano::dev::genesis->hash (), votes1[0]->hashes[0]);
+	ASSERT_EQ (1, votes1[0]->hashes ().size ());
+	ASSERT_EQ (nano::dev::genesis->hash (), votes1[0]->hashes ()[0]);
 	ASSERT_TIMELY_EQ (3s, node.stats.count (nano::stat::type::requests, nano::stat::detail::requests_generated_votes), 1);
 
 	auto send1 = nano::state_block_builder ()
@@ -1891,7 +1951,7 @@ TEST (node, DISABLED_local_votes_cache_generate_new_vote)
 	ASSERT_TIMELY (3s, !node.history.votes (send1->root (), send1->hash ()).empty ());
 	auto votes2 (node.history.votes (send1->root (), send1->hash ()));
 	ASSERT_EQ (1, votes2.size ());
-	ASSERT_EQ (1, votes2[0]->hashes.size ());
+	ASSERT_EQ (1, votes2[0]->hashes ().size ());
 	ASSERT_TIMELY_EQ (3s, node.stats.count (nano::stat::type::requests, nano::stat::detail::requests_generated_votes), 2);
 	ASSERT_FALSE (node.history.votes (nano::dev::genesis->root (), nano::dev::genesis->hash ()).empty ());
 	ASSERT_FALSE (node.history.votes (send1->root (), send1->hash ()).empty ());
@@ -1939,7 +1999,7 @@ TEST (node, DISABLED_local_votes_cache_fork)
 	node1.history.add (send1->root (), send1->hash (), vote);
 	auto votes2 (node1.history.votes (send1->root (), send1->hash ()));
 	ASSERT_EQ (1, votes2.size ());
-	ASSERT_EQ (1, votes2[0]->hashes.size ());
+	ASSERT_EQ (1, votes2[0]->hashes ().size ());
 	// Start election for forked block
 	node_config.peering_port = system.get_available_port ();
 	auto & node2 (*system.add_node (node_config, node_flags));
@@ -2046,9 +2106,9 @@ TEST (node, vote_by_hash_bundle)
 	system.wallet (0)->insert_adhoc (key1.prv);
 
 	system.nodes[0]->observers.vote.add ([&max_hashes] (std::shared_ptr<nano::vote> const & vote_a, std::shared_ptr<nano::transport::channel> const &, nano::vote_source, nano::vote_code) {
-		if (vote_a->hashes.size () > max_hashes)
+		if (vote_a->hashes ().size () > max_hashes)
 		{
-			max_hashes = vote_a->hashes.size ();
+			max_hashes = vote_a->hashes ().size ();
 		}
 	});
 
@@ -0,0 +1,88 @@
+#include <nano/node/pruning_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace
+{
+uint64_t const unlimited_depth = std::numeric_limits<uint64_t>::max ();
+}
+
+TEST (pruning_queue, construction)
+{
+	nano::pruning_queue queue;
+	ASSERT_EQ (queue.size (), 0);
+	ASSERT_TRUE (queue.empty ());
+	ASSERT_FALSE (queue.overflowed ());
+}
+
+TEST (pruning_queue, pop_by_age)
+{
+	nano::pruning_queue queue;
+	queue.push (nano::account{ 1 }, 300, 1, unlimited_depth);
+	queue.push (nano::account{ 2 }, 100, 1, unlimited_depth);
+	queue.push (nano::account{ 3 }, 200, 1, unlimited_depth);
+	ASSERT_EQ (queue.size (), 3);
+
+	// Nothing is old enough
+	ASSERT_TRUE (queue.pop (50, 10).empty ());
+
+	// Oldest first, limited by count
+	auto first = queue.pop (1000, 2);
+	ASSERT_EQ (first.size (), 2);
+	ASSERT_EQ (first[0], nano::account{ 2 });
+	ASSERT_EQ (first[1], nano::account{ 3 });
+
+	auto second = queue.pop (1000, 10);
+	ASSERT_EQ (second.size (), 1);
+	ASSERT_EQ (second[0], nano::account{ 1 });
+	ASSERT_TRUE (queue.empty ());
+}
+
+// Pushing an already queued account keeps the timestamp of its oldest unpruned block
+TEST (pruning_queue, keep_oldest)
+{
+	nano::pruning_queue queue;
+	queue.push (nano::account{ 1 }, 100, 1, unlimited_depth);
+	queue.push (nano::account{ 1 }, 500, 1, unlimited_depth);
+	ASSERT_EQ (queue.size (), 1);
+
+	auto accounts = queue.pop (100, 10);
+	ASSERT_EQ (accounts.size (), 1);
+	ASSERT_EQ (accounts[0], nano::account{ 1 });
+}
+
+// Accounts with enough queued blocks are eligible regardless of age
+TEST (pruning_queue, depth)
+{
+	nano::pruning_queue queue;
+	queue.push (nano::account{ 1 }, 500, 1, 3);
+	queue.push (nano::account{ 1 }, 600, 1, 3);
+	ASSERT_TRUE (queue.pop (100, 10).empty ());
+
+	queue.push (nano::account{ 1 }, 700, 1, 3);
+	auto accounts = queue.pop (100, 10);
+	ASSERT_EQ (accounts.size (), 1);
+	ASSERT_EQ (accounts[0], nano::account{ 1 });
+}
+
+TEST (pruning_queue, overflow)
+{
+	nano::pruning_queue queue{ 2 };
+	queue.push (nano::account{ 1 }, 100, 1, unlimited_depth);
+	queue.push (nano::account{ 2 }, 100, 1, unlimited_depth);
+	ASSERT_FALSE (queue.overflowed ());
+
+	// Already queued accounts can still be updated
+	queue.push (nano::account{ 2 }, 50, 1, unlimited_depth);
+	ASSERT_FALSE (queue.overflowed ());
+
+	queue.push (nano::account{ 3 }, 100, 1, unlimited_depth);
+	ASSERT_TRUE (queue.overflowed ());
+	ASSERT_EQ (queue.size (), 2);
+
+	queue.clear ();
+	ASSERT_FALSE (queue.overflowed ());
+	ASSERT_TRUE (queue.empty ());
+}
@@ -0,0 +1,83 @@
+#include <nano/lib/timer_wheel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+TEST (timer_wheel, empty)
+{
+	nano::timer_wheel<int> wheel;
+	std::vector<nano::timer_wheel<int>::item_t> due;
+	wheel.advance (1000, due);
+	ASSERT_TRUE (due.empty ());
+	ASSERT_EQ (1000, wheel.current ());
+}
+
+TEST (timer_wheel, due_at_deadline)
+{
+	nano::timer_wheel<int> wheel;
+	wheel.insert (5, 1);
+	wheel.insert (3, 2);
+	wheel.insert (0, 3); // Already due, returned on the next advance
+	ASSERT_EQ (3, wheel.size ());
+
+	std::vector<nano::timer_wheel<int>::item_t> due;
+	wheel.advance (1, due);
+	ASSERT_EQ (1, due.size ());
+	ASSERT_EQ (3, due[0].second);
+
+	due.clear ();
+	wheel.advance (4, due);
+	ASSERT_EQ (1, due.size ());
+	ASSERT_EQ (2, due[0].second);
+	ASSERT_EQ (3, due[0].first);
+
+	due.clear ();
+	wheel.advance (5, due);
+	ASSERT_EQ (1, due.size ());
+	ASSERT_EQ (1, due[0].second);
+	ASSERT_TRUE (wheel.empty ());
+}
+
+// Deadlines spread across all levels, including beyond the range of the top level, are returned at the right tick and in order
+TEST (timer_wheel, levels)
+{
+	using wheel_t = nano::timer_wheel<uint64_t>;
+	uint64_t const start = 12345;
+	wheel_t wheel{ start };
+	std::mt19937_64 rng{ 42 };
+	std::vector<uint64_t> deadlines;
+	for (auto range : { uint64_t{ 10 }, uint64_t{ 1000 }, uint64_t{ 100000 }, uint64_t{ 20000000 }, uint64_t{ 40000000 } })
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			auto deadline = start + 1 + rng () % range;
+			deadlines.push_back (deadline);
+			wheel.insert (deadline, deadline);
+		}
+	}
+	std::sort (deadlines.begin (), deadlines.end ());
+
+	std::vector<wheel_t::item_t> due;
+	uint64_t previous = start;
+	for (uint64_t tick = start; tick < deadlines.back (); tick += 1 + rng () % 50)
+	{
+		auto const begin = due.size ();
+		wheel.advance (tick, due);
+		for (auto i = begin; i < due.size (); ++i)
+		{
+			ASSERT_GT (due[i].first, previous);
+			ASSERT_LE (due[i].first, tick);
+			ASSERT_EQ (due[i].first, due[i].second);
+		}
+		previous = tick;
+	}
+	wheel.advance (deadlines.back (), due);
+	ASSERT_TRUE (wheel.empty ());
+	ASSERT_EQ (deadlines.size (), due.size ());
+	for (std::size_t i = 0; i < due.size (); ++i)
+	{
+		ASSERT_EQ (deadlines[i], due[i].first);
+	}
+}
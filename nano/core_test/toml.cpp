@@ -158,6 +158,7 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.backup_before_upgrade, defaults.node.backup_before_upgrade);
 	ASSERT_EQ (conf.node.bandwidth_limit, defaults.node.bandwidth_limit);
 	ASSERT_EQ (conf.node.bandwidth_limit_burst_ratio, defaults.node.bandwidth_limit_burst_ratio);
+	ASSERT_EQ (conf.node.bandwidth_limit_pr_share, defaults.node.bandwidth_limit_pr_share);
 	ASSERT_EQ (conf.node.bootstrap_bandwidth_limit, defaults.node.bootstrap_bandwidth_limit);
 	ASSERT_EQ (conf.node.bootstrap_bandwidth_burst_ratio, defaults.node.bootstrap_bandwidth_burst_ratio);
 	ASSERT_EQ (conf.node.block_processor_batch_max_time, defaults.node.block_processor_batch_max_time);
@@ -172,6 +173,7 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.external_address, defaults.node.external_address);
 	ASSERT_EQ (conf.node.external_port, defaults.node.external_port);
 	ASSERT_EQ (conf.node.io_threads, defaults.node.io_threads);
+	ASSERT_EQ (conf.node.io_shards, defaults.node.io_shards);
 	ASSERT_EQ (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
 	ASSERT_EQ (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_EQ (conf.node.background_threads, defaults.node.background_threads);
@@ -192,12 +194,14 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.use_memory_pools, defaults.node.use_memory_pools);
 	ASSERT_EQ (conf.node.vote_generator_delay, defaults.node.vote_generator_delay);
 	ASSERT_EQ (conf.node.vote_generator_threshold, defaults.node.vote_generator_threshold);
+	ASSERT_EQ (conf.node.vote_generator_threads, defaults.node.vote_generator_threads);
 	ASSERT_EQ (conf.node.vote_minimum, defaults.node.vote_minimum);
 	ASSERT_EQ (conf.node.work_peers, defaults.node.work_peers);
 	ASSERT_EQ (conf.node.work_threads, defaults.node.work_threads);
 	ASSERT_EQ (conf.node.max_queued_requests, defaults.node.max_queued_requests);
 	ASSERT_EQ (conf.node.request_aggregator_threads, defaults.node.request_aggregator_threads);
-	ASSERT_EQ (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
+	ASSERT_EQ (conf.node.max_unchecked_memory, defaults.node.max_unchecked_memory);
+	ASSERT_EQ (conf.node.block_filter_memory, defaults.node.block_filter_memory);
 	ASSERT_EQ (conf.node.backlog_population.enable, defaults.node.backlog_population.enable);
 	ASSERT_EQ (conf.node.backlog_population.batch_size, defaults.node.backlog_population.batch_size);
 	ASSERT_EQ (conf.node.backlog_population.frequency, defaults.node.backlog_population.frequency);
@@ -282,10 +286,13 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.bootstrap_ascending.throttle_wait, defaults.node.bootstrap_ascending.throttle_wait);
 	ASSERT_EQ (conf.node.bootstrap_ascending.block_processor_threshold, defaults.node.bootstrap_ascending.block_processor_threshold);
 	ASSERT_EQ (conf.node.bootstrap_ascending.max_requests, defaults.node.bootstrap_ascending.max_requests);
+	ASSERT_EQ (conf.node.bootstrap_ascending.enable_pipelining, defaults.node.bootstrap_ascending.enable_pipelining);
+	ASSERT_EQ (conf.node.bootstrap_ascending.max_staged_blocks, defaults.node.bootstrap_ascending.max_staged_blocks);
 
 	ASSERT_EQ (conf.node.bootstrap_server.max_queue, defaults.node.bootstrap_server.max_queue);
 	ASSERT_EQ (conf.node.bootstrap_server.threads, defaults.node.bootstrap_server.threads);
 	ASSERT_EQ (conf.node.bootstrap_server.batch_size, defaults.node.bootstrap_server.batch_size);
+	ASSERT_EQ (conf.node.bootstrap_server.cache_size, defaults.node.bootstrap_server.cache_size);
 
 	ASSERT_EQ (conf.node.request_aggregator.max_queue, defaults.node.request_aggregator.max_queue);
 	ASSERT_EQ (conf.node.request_aggregator.threads, defaults.node.request_aggregator.threads);
@@ -424,6 +431,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	backup_before_upgrade = true
 	bandwidth_limit = 999
 	bandwidth_limit_burst_ratio = 999.9
+	bandwidth_limit_pr_share = 999
 	bootstrap_bandwidth_limit = 999
 	bootstrap_bandwidth_burst_ratio = 999.9
 	block_processor_batch_max_time = 999
@@ -438,6 +446,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	external_address = "0:0:0:0:0:ffff:7f01:101"
 	external_port = 999
 	io_threads = 999
+	io_shards = 999
 	lmdb_max_dbs = 999
 	network_threads = 999
 	background_threads = 999
@@ -457,13 +466,15 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	use_memory_pools = false
 	vote_generator_delay = 999
 	vote_generator_threshold = 9
+	vote_generator_threads = 999
 	vote_minimum = "999"
 	work_peers = ["dev.org:999"]
 	work_threads = 999
 	max_work_generate_multiplier = 1.0
 	max_queued_requests = 999
 	request_aggregator_threads = 999
-	max_unchecked_blocks = 999
+	max_unchecked_memory = 999
+	block_filter_memory = 999
 	frontiers_confirmation = "always"
 	enable_upnp = false
 
@@ -613,11 +624,14 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	throttle_wait = 999
 	block_processor_threshold = 999
 	max_requests = 999
+	enable_pipelining = false
+	max_staged_blocks = 999
 
 	[node.bootstrap_server]
 	max_queue = 999
 	threads = 999
 	batch_size = 999
+	cache_size = 999
 
 	[node.request_aggregator]
 	max_queue = 999
@@ -665,6 +679,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.backup_before_upgrade, defaults.node.backup_before_upgrade);
 	ASSERT_NE (conf.node.bandwidth_limit, defaults.node.bandwidth_limit);
 	ASSERT_NE (conf.node.bandwidth_limit_burst_ratio, defaults.node.bandwidth_limit_burst_ratio);
+	ASSERT_NE (conf.node.bandwidth_limit_pr_share, defaults.node.bandwidth_limit_pr_share);
 	ASSERT_NE (conf.node.bootstrap_bandwidth_limit, defaults.node.bootstrap_bandwidth_limit);
 	ASSERT_NE (conf.node.bootstrap_bandwidth_burst_ratio, defaults.node.bootstrap_bandwidth_burst_ratio);
 	ASSERT_NE (conf.node.block_processor_batch_max_time, defaults.node.block_processor_batch_max_time);
@@ -679,8 +694,10 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.external_address, defaults.node.external_address);
 	ASSERT_NE (conf.node.external_port, defaults.node.external_port);
 	ASSERT_NE (conf.node.io_threads, defaults.node.io_threads);
+	ASSERT_NE (conf.node.io_shards, defaults.node.io_shards);
 	ASSERT_NE (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
-	ASSERT_NE (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
+	ASSERT_NE (conf.node.max_unchecked_memory, defaults.node.max_unchecked_memory);
+	ASSERT_NE (conf.node.block_filter_memory, defaults.node.block_filter_memory);
 	ASSERT_NE (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_NE (conf.node.background_threads, defaults.node.background_threads);
 	ASSERT_NE (conf.node.secondary_work_peers, defaults.node.secondary_work_peers);
@@ -702,6 +719,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.use_memory_pools, defaults.node.use_memory_pools);
 	ASSERT_NE (conf.node.vote_generator_delay, defaults.node.vote_generator_delay);
 	ASSERT_NE (conf.node.vote_generator_threshold, defaults.node.vote_generator_threshold);
+	ASSERT_NE (conf.node.vote_generator_threads, defaults.node.vote_generator_threads);
 	ASSERT_NE (conf.node.vote_minimum, defaults.node.vote_minimum);
 	ASSERT_NE (conf.node.work_peers, defaults.node.work_peers);
 	ASSERT_NE (conf.node.work_threads, defaults.node.work_threads);
@@ -793,10 +811,13 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.bootstrap_ascending.throttle_wait, defaults.node.bootstrap_ascending.throttle_wait);
 	ASSERT_NE (conf.node.bootstrap_ascending.block_processor_threshold, defaults.node.bootstrap_ascending.block_processor_threshold);
 	ASSERT_NE (conf.node.bootstrap_ascending.max_requests, defaults.node.bootstrap_ascending.max_requests);
+	ASSERT_NE (conf.node.bootstrap_ascending.enable_pipelining, defaults.node.bootstrap_ascending.enable_pipelining);
+	ASSERT_NE (conf.node.bootstrap_ascending.max_staged_blocks, defaults.node.bootstrap_ascending.max_staged_blocks);
 
 	ASSERT_NE (conf.node.bootstrap_server.max_queue, defaults.node.bootstrap_server.max_queue);
 	ASSERT_NE (conf.node.bootstrap_server.threads, defaults.node.bootstrap_server.threads);
 	ASSERT_NE (conf.node.bootstrap_server.batch_size, defaults.node.bootstrap_server.batch_size);
+	ASSERT_NE (conf.node.bootstrap_server.cache_size, defaults.node.bootstrap_server.cache_size);
 
 	ASSERT_NE (conf.node.request_aggregator.max_queue, defaults.node.request_aggregator.max_queue);
 	ASSERT_NE (conf.node.request_aggregator.threads, defaults.node.request_aggregator.threads);
@@ -1003,6 +1024,10 @@ TEST (toml, log_config_defaults)
 	ASSERT_EQ (confg.file.enable, defaults.file.enable);
 	ASSERT_EQ (confg.file.max_size, defaults.file.max_size);
 	ASSERT_EQ (confg.file.rotation_count, defaults.file.rotation_count);
+	ASSERT_EQ (confg.trace_ring_size, defaults.trace_ring_size);
+	ASSERT_EQ (confg.async.enable, defaults.async.enable);
+	ASSERT_EQ (confg.async.queue_size, defaults.async.queue_size);
+	ASSERT_EQ (confg.async.overflow_policy, defaults.async.overflow_policy);
 }
 
 TEST (toml, log_config_no_defaults)
@@ -1013,6 +1038,7 @@ TEST (toml, log_config_no_defaults)
 	ss << R"toml(
 	[log]
 	default_level = "trace"
+	trace_ring_size = 999
 
 	[log.console]
 	colors = false
@@ -1024,6 +1050,11 @@ TEST (toml, log_config_no_defaults)
 	max_size = 999
 	rotation_count = 999
 
+	[log.async]
+	enable = true
+	queue_size = 999
+	overflow_policy = "drop"
+
 	[log.levels]
 	active_elections = "trace"
 	blockprocessor = "trace"
@@ -1045,6 +1076,10 @@ TEST (toml, log_config_no_defaults)
 	ASSERT_NE (confg.file.enable, defaults.file.enable);
 	ASSERT_NE (confg.file.max_size, defaults.file.max_size);
 	ASSERT_NE (confg.file.rotation_count, defaults.file.rotation_count);
+	ASSERT_NE (confg.trace_ring_size, defaults.trace_ring_size);
+	ASSERT_NE (confg.async.enable, defaults.async.enable);
+	ASSERT_NE (confg.async.queue_size, defaults.async.queue_size);
+	ASSERT_NE (confg.async.overflow_policy, defaults.async.overflow_policy);
 }
 
 TEST (toml, log_config_no_required)
@@ -160,6 +160,17 @@ TEST (uint128_union, decode_decimal)
 	ASSERT_EQ (1230 * nano::Gxrb_ratio, amount.number ());
 }
 
+TEST (uint128_union, native)
+{
+	for (auto const & value : { nano::uint128_t{ 0 }, nano::uint128_t{ 1 }, nano::uint128_t{ std::numeric_limits<uint64_t>::max () }, nano::uint128_t{ 1 } << 64, nano::Gxrb_ratio * 123 + 456, std::numeric_limits<nano::uint128_t>::max () })
+	{
+		ASSERT_EQ (value, nano::from_native (nano::to_native (value)));
+		ASSERT_EQ (value, nano::from_native (nano::uint128_union{ value }.number_native ()));
+	}
+	ASSERT_TRUE (nano::to_native (nano::Gxrb_ratio) < nano::to_native (nano::Gxrb_ratio + 1));
+	ASSERT_EQ (nano::Gxrb_ratio * 2, nano::from_native (nano::to_native (nano::Gxrb_ratio) + nano::to_native (nano::Gxrb_ratio)));
+}
+
 TEST (unions, identity)
 {
 	ASSERT_EQ (1, nano::uint128_union (1).number ().convert_to<uint8_t> ());
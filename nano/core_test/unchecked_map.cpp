@@ -15,14 +15,14 @@ using namespace std::chrono_literals;
 
 namespace
 {
-unsigned max_unchecked_blocks = 65536;
+std::size_t max_unchecked_memory = 32 * 1024 * 1024;
 
 class context
 {
 public:
 	context () :
 		stats{ logger },
-		unchecked{ max_unchecked_blocks, stats, false }
+		unchecked{ max_unchecked_memory, stats, false }
 	{
 	}
 	nano::logger logger;
@@ -60,7 +60,7 @@ TEST (unchecked_map, put_one)
 TEST (block_store, one_bootstrap)
 {
 	nano::test::system system{};
-	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
 	nano::block_builder builder;
 	auto block1 = builder
 				  .send ()
@@ -93,7 +93,7 @@ TEST (block_store, one_bootstrap)
 TEST (unchecked, simple)
 {
 	nano::test::system system{};
-	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
 	nano::block_builder builder;
 	auto block = builder
 				 .send ()
@@ -134,7 +134,7 @@ TEST (unchecked, multiple)
 		// Don't test this in rocksdb mode
 		GTEST_SKIP ();
 	}
-	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
 	nano::block_builder builder;
 	auto block = builder
 				 .send ()
@@ -164,7 +164,7 @@ TEST (unchecked, multiple)
 TEST (unchecked, double_put)
 {
 	nano::test::system system{};
-	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
 	nano::block_builder builder;
 	auto block = builder
 				 .send ()
@@ -195,7 +195,7 @@ TEST (unchecked, double_put)
 TEST (unchecked, multiple_get)
 {
 	nano::test::system system{};
-	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
 	// Instantiates three blocks
 	nano::block_builder builder;
 	auto block1 = builder
@@ -280,3 +280,64 @@ TEST (unchecked, multiple_get)
 	auto unchecked5 = unchecked.get (block2->hash ());
 	ASSERT_EQ (unchecked5.size (), 0);
 }
+
+// Once the memory budget is exceeded the oldest entries are dropped
+TEST (unchecked, memory_budget)
+{
+	nano::test::system system{};
+	std::size_t const max_memory = 16 * 16 * 1024;
+	nano::unchecked_map unchecked{ max_memory, system.stats, false };
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (auto i = 0; i < 1000; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (4)
+						  .destination (1)
+						  .balance (i)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build ());
+		// All entries share a dependency and therefore a shard
+		unchecked.put (blocks.back ()->previous (), nano::unchecked_info (blocks.back ()));
+	}
+	ASSERT_LT (unchecked.count (), 1000);
+	ASSERT_LE (unchecked.memory (), max_memory / 16);
+	ASSERT_EQ (1000 - unchecked.count (), system.stats.count (nano::stat::type::unchecked, nano::stat::detail::erase_oldest));
+	ASSERT_FALSE (unchecked.exists (nano::unchecked_key{ 4, blocks.front ()->hash () }));
+	ASSERT_TRUE (unchecked.exists (nano::unchecked_key{ 4, blocks.back ()->hash () }));
+	unchecked.clear ();
+	ASSERT_EQ (0, unchecked.count ());
+	ASSERT_EQ (0, unchecked.memory ());
+}
+
+// Triggering a dependency releases all its dependents and records how long they waited
+TEST (unchecked, trigger)
+{
+	nano::test::system system{};
+	nano::unchecked_map unchecked{ max_unchecked_memory, system.stats, false };
+	unchecked.start ();
+	std::atomic<int> satisfied{ 0 };
+	unchecked.satisfied.add ([&satisfied] (nano::unchecked_info const &) { ++satisfied; });
+	nano::block_builder builder;
+	for (auto i = 0; i < 3; ++i)
+	{
+		auto block = builder
+					 .send ()
+					 .previous (4)
+					 .destination (1)
+					 .balance (i)
+					 .sign (nano::keypair ().prv, 4)
+					 .work (5)
+					 .build ();
+		unchecked.put (block->previous (), nano::unchecked_info (block));
+	}
+	unchecked.put (5, nano::unchecked_info (block ()));
+	unchecked.trigger (4);
+	ASSERT_TIMELY_EQ (5s, satisfied, 3);
+	ASSERT_EQ (1, unchecked.count ());
+	ASSERT_TRUE (unchecked.get (4).empty ());
+	ASSERT_EQ (3, system.stats.samples (nano::stat::sample::unchecked_dependency_time).size ());
+	unchecked.stop ();
+}
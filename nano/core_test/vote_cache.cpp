@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include <deque>
 #include <map>
 
 namespace
@@ -313,6 +314,45 @@ TEST (vote_cache, overfill)
 	ASSERT_EQ (tops[0].tally, 1024);
 }
 
+/*
+ * Ensure entries remain reachable when slots are repeatedly erased and reused
+ */
+TEST (vote_cache, erase_reinsert)
+{
+	nano::test::system system;
+	nano::vote_cache_config cfg;
+	cfg.max_size = 256;
+	nano::vote_cache vote_cache{ cfg, system.stats };
+	vote_cache.rep_weight_query = rep_weight_query ();
+	auto rep1 = create_rep (7);
+
+	std::deque<nano::block_hash> hashes;
+	for (int n = 0; n < 4 * 1024; ++n)
+	{
+		auto hash = nano::test::random_hash ();
+		vote_cache.insert (nano::test::make_vote (rep1, { hash }, 1024 * 1024));
+		hashes.push_back (hash);
+
+		// Oldest entries are evicted once full
+		while (hashes.size () > cfg.max_size)
+		{
+			ASSERT_TRUE (vote_cache.find (hashes.front ()).empty ());
+			hashes.pop_front ();
+		}
+		// Erase every third entry to create gaps in the table
+		if (n % 3 == 0)
+		{
+			ASSERT_TRUE (vote_cache.erase (hashes.front ()));
+			hashes.pop_front ();
+		}
+	}
+	ASSERT_EQ (hashes.size (), vote_cache.size ());
+	for (auto const & hash : hashes)
+	{
+		ASSERT_EQ (1, vote_cache.find (hash).size ());
+	}
+}
+
 /*
  * Check that when a single vote cache entry is overfilled, it ignores any new votes
  */
@@ -319,7 +319,7 @@ TEST (vote_processor, large_votes)
 	ASSERT_TIMELY (5s, nano::test::active (node, blocks));
 
 	auto vote = nano::test::make_final_vote (nano::dev::genesis_key, blocks);
-	ASSERT_EQ (vote->hashes.size (), count);
+	ASSERT_EQ (vote->hashes ().size (), count);
 
 	node.vote_processor.vote (vote, nano::test::fake_channel (node));
 
@@ -348,3 +348,37 @@ TEST (vote, empty_hashes)
 	nano::keypair key;
 	auto vote = std::make_shared<nano::vote> (key.pub, key.prv, 0, 0, std::vector<nano::block_hash>{} /* empty */);
 }
+
+/**
+ * Votes keep up to `inline_hashes` hashes inline and larger votes spill to a separate buffer, both round trip and keep a valid cached hash
+ */
+TEST (vote, inline_hashes)
+{
+	nano::keypair key;
+	for (std::size_t count : { std::size_t{ 1 }, nano::vote::inline_hashes, nano::vote::inline_hashes + 1, nano::vote::max_hashes })
+	{
+		std::vector<nano::block_hash> hashes;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			hashes.push_back (i + 1);
+		}
+		nano::vote vote{ key.pub, key.prv, nano::vote::timestamp_min, 0, hashes };
+		ASSERT_EQ (count, vote.hashes ().size ());
+		ASSERT_EQ (count <= nano::vote::inline_hashes, vote.hashes ().capacity () == nano::vote::inline_hashes);
+		ASSERT_FALSE (vote.validate ());
+
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream{ bytes };
+			vote.serialize (stream);
+		}
+		bool error = false;
+		nano::bufferstream stream{ bytes.data (), bytes.size () };
+		nano::vote vote2{ error, stream };
+		ASSERT_FALSE (error);
+		ASSERT_EQ (vote, vote2);
+		ASSERT_EQ (vote.hash (), vote2.hash ());
+		ASSERT_EQ (vote.full_hash (), vote2.full_hash ());
+		ASSERT_FALSE (vote2.validate ());
+	}
+}
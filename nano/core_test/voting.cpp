@@ -69,7 +69,7 @@ TEST (vote_generator, cache)
 	ASSERT_TIMELY (1s, !node.history.votes (epoch1->root (), epoch1->hash ()).empty ());
 	auto votes (node.history.votes (epoch1->root (), epoch1->hash ()));
 	ASSERT_FALSE (votes.empty ());
-	ASSERT_TRUE (std::any_of (votes[0]->hashes.begin (), votes[0]->hashes.end (), [hash = epoch1->hash ()] (nano::block_hash const & hash_a) { return hash_a == hash; }));
+	ASSERT_TRUE (std::any_of (votes[0]->hashes ().begin (), votes[0]->hashes ().end (), [hash = epoch1->hash ()] (nano::block_hash const & hash_a) { return hash_a == hash; }));
 }
 
 TEST (vote_generator, multiple_representatives)
@@ -109,6 +109,41 @@ TEST (vote_generator, multiple_representatives)
 	}
 }
 
+namespace nano
+{
+// Batches for the same root are signed in parallel, but history and actions see them in the order they were submitted
+TEST (vote_generator, ordering)
+{
+	nano::test::system system (1);
+	auto & node (*system.nodes[0]);
+	system.wallet (0)->insert_adhoc (nano::dev::genesis_key.prv);
+	nano::root const root{ 1 };
+	std::size_t const count = 100;
+	nano::mutex mutex;
+	std::vector<std::shared_ptr<nano::vote>> votes;
+	std::atomic<std::size_t> completed{ 0 };
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		node.generator.vote ({ nano::block_hash{ i + 1 } }, { root }, [&mutex, &votes, &completed] (std::shared_ptr<nano::vote> const & vote_a) {
+			nano::lock_guard<nano::mutex> guard{ mutex };
+			votes.push_back (vote_a);
+			++completed;
+		});
+	}
+	ASSERT_TIMELY_EQ (5s, completed, count);
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		ASSERT_EQ (nano::block_hash{ i + 1 }, votes[i]->hashes ()[0]);
+	}
+	// History ends with the vote of the last submission
+	ASSERT_TRUE (node.history.votes (root, nano::block_hash{ count - 1 }).empty ());
+	auto history_votes = node.history.votes (root, nano::block_hash{ count });
+	ASSERT_EQ (1, history_votes.size ());
+	ASSERT_EQ (votes.back (), history_votes[0]);
+}
+}
+
 TEST (vote_spacing, basic)
 {
 	nano::vote_spacing spacing{ std::chrono::milliseconds{ 100 } };
@@ -1144,6 +1144,37 @@ TEST (wallet, foreach_representative_deadlock)
 	ASSERT_TRUE (set);
 }
 
+/**
+ * Representative keys are cached between calls and follow wallet lock state
+ */
+TEST (wallet, foreach_representative_lock)
+{
+	nano::test::system system (1);
+	auto & node (*system.nodes[0]);
+	auto wallet (system.wallet (0));
+	auto count = [&node] () {
+		std::size_t result = 0;
+		node.wallets.foreach_representative ([&result] (nano::public_key const & pub, nano::raw_key const & prv) {
+			ASSERT_EQ (nano::dev::genesis_key.pub, pub);
+			ASSERT_EQ (nano::dev::genesis_key.prv, prv);
+			++result;
+		});
+		return result;
+	};
+	ASSERT_EQ (0, count ());
+	wallet->insert_adhoc (nano::dev::genesis_key.prv);
+	ASSERT_EQ (1, count ());
+	ASSERT_EQ (1, count ());
+
+	wallet->lock ();
+	ASSERT_EQ (0, count ());
+	{
+		auto transaction (node.wallets.tx_begin_read ());
+		ASSERT_FALSE (wallet->enter_password (transaction, ""));
+	}
+	ASSERT_EQ (1, count ());
+}
+
 TEST (wallet, search_receivable)
 {
 	nano::test::system system;
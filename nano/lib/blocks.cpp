@@ -2,6 +2,7 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/enum_util.hpp>
 #include <nano/lib/memory.hpp>
+#include <nano/lib/object_pool.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/secure/common.hpp>
@@ -33,7 +34,16 @@ template <typename block>
 std::shared_ptr<block> deserialize_block (nano::stream & stream_a)
 {
 	auto error (false);
-	auto result = nano::make_shared<block> (error, stream_a);
+	std::shared_ptr<block> result;
+	// State blocks make up nearly all network traffic and are drawn from a thread caching pool
+	if constexpr (std::is_same_v<block, nano::state_block>)
+	{
+		result = nano::make_pooled<block> (error, stream_a);
+	}
+	else
+	{
+		result = nano::make_shared<block> (error, stream_a);
+	}
 	if (error)
 	{
 		result = nullptr;
@@ -0,0 +1,76 @@
+#include <nano/lib/io_shards.hpp>
+#include <nano/lib/thread_runner.hpp>
+#include <nano/lib/threading.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <boost/asio/post.hpp>
+
+nano::io_shards::io_shards (unsigned count, nano::logger & logger)
+{
+	// Only cores allowed by the affinity mask or cpuset of the process are used, which may be fewer than the cores of the machine
+	auto const cpus = nano::allowed_cpus ();
+	if (cpus.empty ())
+	{
+		logger.debug (nano::log::type::thread_runner, "Unable to determine allowed cores, IO shard threads will not be pinned");
+	}
+
+	shards.reserve (count);
+	for (unsigned i = 0; i < count; ++i)
+	{
+		// Each context is only ever run by a single thread
+		auto io_ctx = std::make_shared<boost::asio::io_context> (1);
+		auto runner = std::make_unique<nano::thread_runner> (io_ctx, logger, 1, nano::thread_role::name::io_shard);
+
+		if (!cpus.empty ())
+		{
+			auto const cpu = cpus[i % cpus.size ()];
+			boost::asio::post (*io_ctx, [&logger, cpu] () {
+				if (nano::pin_current_thread (cpu))
+				{
+					logger.debug (nano::log::type::thread_runner, "Unable to pin IO shard thread to core: {}", cpu);
+				}
+			});
+		}
+
+		shards.push_back ({ std::move (io_ctx), std::move (runner) });
+	}
+}
+
+nano::io_shards::~io_shards () = default;
+
+void nano::io_shards::stop ()
+{
+	for (auto & shard : shards)
+	{
+		shard.runner->join ();
+	}
+}
+
+bool nano::io_shards::empty () const
+{
+	return shards.empty ();
+}
+
+std::size_t nano::io_shards::size () const
+{
+	return shards.size ();
+}
+
+boost::asio::io_context & nano::io_shards::next ()
+{
+	debug_assert (!shards.empty ());
+	return get (next_index++ % shards.size ());
+}
+
+boost::asio::io_context & nano::io_shards::get (std::size_t index)
+{
+	debug_assert (index < shards.size ());
+	return *shards[index].io_ctx;
+}
+
+std::unique_ptr<nano::container_info_component> nano::io_shards::collect_container_info (std::string const & name) const
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "shards", shards.size (), sizeof (shard) }));
+	return composite;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <nano/boost/asio/io_context.hpp>
+#include <nano/lib/logging.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nano
+{
+class container_info_component;
+class thread_runner;
+
+/**
+ * Set of independent IO contexts, each driven by a single thread pinned to its own processor core where supported
+ * Sockets placed on a shard have all their handlers run by that shard's thread, which keeps their state local to one core
+ * Work is handed to other threads through queues, never by running handlers of another shard
+ */
+class io_shards final
+{
+public:
+	io_shards (unsigned count, nano::logger &);
+	~io_shards ();
+
+	/** Waits for all shards to run out of work and joins their threads */
+	void stop ();
+
+	bool empty () const;
+	std::size_t size () const;
+
+	/** Selects shards in round robin order, used to spread new sockets evenly */
+	boost::asio::io_context & next ();
+	boost::asio::io_context & get (std::size_t index);
+
+	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name) const;
+
+private:
+	struct shard
+	{
+		std::shared_ptr<boost::asio::io_context> io_ctx;
+		std::unique_ptr<nano::thread_runner> runner;
+	};
+
+	std::vector<shard> shards;
+	std::atomic<std::size_t> next_index{ 0 };
+};
+}
@@ -3,9 +3,11 @@
 #include <nano/lib/env.hpp>
 #include <nano/lib/logging.hpp>
 #include <nano/lib/logging_enums.hpp>
+#include <nano/lib/thread_roles.hpp>
 #include <nano/lib/utility.hpp>
 
 #include <fmt/chrono.h>
+#include <spdlog/async.h>
 #include <spdlog/pattern_formatter.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/rotating_file_sink.h>
@@ -25,7 +27,9 @@ nano::logger & nano::default_logger ()
 bool nano::logger::global_initialized{ false };
 nano::log_config nano::logger::global_config{};
 std::vector<spdlog::sink_ptr> nano::logger::global_sinks{};
+std::shared_ptr<spdlog::details::thread_pool> nano::logger::global_thread_pool{};
 nano::object_stream_config nano::logger::global_tracing_config{};
+std::unique_ptr<nano::log::trace_recorder> nano::logger::global_trace_recorder{};
 
 // By default, use only the tag as the logger name, since only one node is running in the process
 std::function<std::string (nano::log::logger_id, std::string identifier)> nano::logger::global_name_formatter{ [] (nano::log::logger_id logger_id, std::string identifier) {
@@ -188,6 +192,18 @@ void nano::logger::initialize_common (nano::log_config const & config, std::opti
 		}
 	}
 
+	// Async setup
+	// Loggers created from now on will enqueue formatted messages into a shared, preallocated queue drained by a single writer thread
+	// The pool is kept alive for the lifetime of the process, since already created async loggers only hold a weak reference to it
+	if (config.async.enable && !global_thread_pool)
+	{
+		release_assert (config.async.queue_size > 0, "async log queue size must be greater than zero");
+
+		global_thread_pool = std::make_shared<spdlog::details::thread_pool> (config.async.queue_size, /* single writer thread */ 1, [] () {
+			nano::thread_role::set (nano::thread_role::name::log_writer);
+		});
+	}
+
 	// Tracing setup
 	switch (config.tracing_format)
 	{
@@ -197,6 +213,28 @@ void nano::logger::initialize_common (nano::log_config const & config, std::opti
 		case nano::log::tracing_format::json:
 			global_tracing_config = nano::object_stream_config::json_config ();
 			break;
+		case nano::log::tracing_format::binary:
+			global_tracing_config = nano::log::trace_recorder::binary_config ();
+			break;
+	}
+
+	global_trace_recorder.reset ();
+	if (config.tracing_format == nano::log::tracing_format::binary && !data_path)
+	{
+		std::cerr << "WARNING: Binary tracing requires a data path, falling back to standard tracing format" << std::endl;
+		global_tracing_config = nano::object_stream_config::default_config ();
+	}
+	else if (config.tracing_format == nano::log::tracing_format::binary)
+	{
+		auto now = std::chrono::system_clock::now ();
+		auto time = std::chrono::system_clock::to_time_t (now);
+
+		std::filesystem::path trace_path{ data_path.value () / "log" / fmt::format ("trace_{:%Y-%m-%d_%H-%M-%S}", fmt::localtime (time)) };
+		trace_path = std::filesystem::absolute (trace_path);
+
+		std::cerr << "Recording binary traces to: " << trace_path.string () << std::endl;
+
+		global_trace_recorder = std::make_unique<nano::log::trace_recorder> (trace_path, config.trace_ring_size);
 	}
 }
 
@@ -220,6 +258,11 @@ nano::logger::logger (std::string identifier) :
 
 nano::logger::~logger ()
 {
+	// Async loggers enqueue the flush request behind any pending messages
+	for (auto & [logger_id, spd_logger] : spd_loggers)
+	{
+		spd_logger->flush ();
+	}
 	flush ();
 }
 
@@ -249,7 +292,8 @@ std::shared_ptr<spdlog::logger> nano::logger::make_logger (nano::log::logger_id
 	auto const & sinks = global_sinks;
 
 	auto name = global_name_formatter (logger_id, identifier);
-	auto spd_logger = std::make_shared<spdlog::logger> (name, sinks.begin (), sinks.end ());
+	auto spd_logger = global_thread_pool ? std::make_shared<spdlog::async_logger> (name, sinks.begin (), sinks.end (), global_thread_pool, to_spdlog_overflow_policy (config.async.overflow_policy))
+										 : std::make_shared<spdlog::logger> (name, sinks.begin (), sinks.end ());
 
 	spd_logger->set_level (to_spdlog_level (find_level (logger_id)));
 	spd_logger->flush_on (to_spdlog_level (config.flush_level));
@@ -299,6 +343,19 @@ spdlog::level::level_enum nano::logger::to_spdlog_level (nano::log::level level)
 	return spdlog::level::off;
 }
 
+spdlog::async_overflow_policy nano::logger::to_spdlog_overflow_policy (nano::log::overflow_policy policy)
+{
+	switch (policy)
+	{
+		case nano::log::overflow_policy::block:
+			return spdlog::async_overflow_policy::block;
+		case nano::log::overflow_policy::drop:
+			return spdlog::async_overflow_policy::overrun_oldest;
+	}
+	debug_assert (false, "Invalid overflow policy");
+	return spdlog::async_overflow_policy::block;
+}
+
 /*
  * logging config presets
  */
@@ -370,6 +427,7 @@ nano::error nano::log_config::deserialize_toml (nano::tomlconfig & toml)
 void nano::log_config::serialize (nano::tomlconfig & toml) const
 {
 	toml.put ("default_level", std::string{ to_string (default_level) });
+	toml.put ("trace_ring_size", trace_ring_size);
 
 	nano::tomlconfig console_config;
 	console_config.put ("enable", console.enable);
@@ -383,6 +441,12 @@ void nano::log_config::serialize (nano::tomlconfig & toml) const
 	file_config.put ("rotation_count", file.rotation_count);
 	toml.put_child ("file", file_config);
 
+	nano::tomlconfig async_config;
+	async_config.put ("enable", async.enable);
+	async_config.put ("queue_size", async.queue_size);
+	async_config.put ("overflow_policy", std::string{ to_string (async.overflow_policy) });
+	toml.put_child ("async", async_config);
+
 	nano::tomlconfig levels_config;
 	for (auto const & [logger_id, level] : levels)
 	{
@@ -400,6 +464,8 @@ void nano::log_config::deserialize (nano::tomlconfig & toml)
 		default_level = nano::log::parse_level (default_level_l);
 	}
 
+	toml.get ("trace_ring_size", trace_ring_size);
+
 	if (toml.has_key ("console"))
 	{
 		auto console_config = toml.get_required_child ("console");
@@ -416,6 +482,18 @@ void nano::log_config::deserialize (nano::tomlconfig & toml)
 		file_config.get ("rotation_count", file.rotation_count);
 	}
 
+	if (toml.has_key ("async"))
+	{
+		auto async_config = toml.get_required_child ("async");
+		async_config.get ("enable", async.enable);
+		async_config.get ("queue_size", async.queue_size);
+		if (async_config.has_key ("overflow_policy"))
+		{
+			auto overflow_policy_l = async_config.get<std::string> ("overflow_policy");
+			async.overflow_policy = nano::log::parse_overflow_policy (overflow_policy_l);
+		}
+	}
+
 	if (toml.has_key ("levels"))
 	{
 		auto levels_config = toml.get_required_child ("levels");
@@ -4,6 +4,7 @@
 #include <nano/lib/object_stream.hpp>
 #include <nano/lib/object_stream_adapters.hpp>
 #include <nano/lib/tomlconfig.hpp>
+#include <nano/lib/trace_recorder.hpp>
 
 #include <initializer_list>
 #include <memory>
@@ -13,6 +14,15 @@
 #include <fmt/ostream.h>
 #include <spdlog/spdlog.h>
 
+namespace spdlog
+{
+enum class async_overflow_policy;
+namespace details
+{
+	class thread_pool;
+}
+}
+
 namespace nano::log
 {
 template <class T>
@@ -28,6 +38,27 @@ struct arg
 	}
 };
 
+/**
+ * Defers evaluation of a log argument until the message is actually formatted, i.e. after the level filter has passed.
+ * Usage: `logger.debug (type, "{}", nano::log::lazy ([&] { return expensive_to_string (); }))`
+ */
+template <class Func>
+struct lazy
+{
+	Func func;
+
+	explicit lazy (Func func_a) :
+		func{ std::move (func_a) }
+	{
+	}
+
+	// Needed for fmt formatting
+	friend auto format_as (lazy<Func> const & self)
+	{
+		return self.func ();
+	}
+};
+
 using logger_id = std::pair<nano::log::type, nano::log::detail>;
 
 std::string to_string (logger_id);
@@ -127,10 +158,21 @@ public:
 		std::size_t rotation_count{ 4 };
 	};
 
+	/// When enabled, messages are formatted on the calling thread and handed over to a dedicated writer thread via a preallocated ring buffer
+	struct async_config
+	{
+		bool enable{ false };
+		std::size_t queue_size{ 8192 };
+		nano::log::overflow_policy overflow_policy{ nano::log::overflow_policy::block };
+	};
+
 	console_config console;
 	file_config file;
+	async_config async;
 
 	nano::log::tracing_format tracing_format{ nano::log::tracing_format::standard };
+	/// Size of each per thread ring file when using the binary tracing format
+	std::size_t trace_ring_size{ 16 * 1024 * 1024 };
 
 public: // Predefined defaults
 	static log_config cli_default ();
@@ -163,8 +205,10 @@ private:
 	static bool global_initialized;
 	static nano::log_config global_config;
 	static std::vector<spdlog::sink_ptr> global_sinks;
+	static std::shared_ptr<spdlog::details::thread_pool> global_thread_pool; // Only set when async logging is enabled
 	static std::function<std::string (nano::log::logger_id, std::string identifier)> global_name_formatter;
 	static nano::object_stream_config global_tracing_config;
+	static std::unique_ptr<nano::log::trace_recorder> global_trace_recorder; // Only set when using the binary tracing format
 
 	static void initialize_common (nano::log_config const &, std::optional<std::filesystem::path> data_path);
 
@@ -213,11 +257,24 @@ public:
 		{
 			debug_assert (detail != nano::log::detail::all);
 
+			auto & logger = get_logger (type, detail);
+			if (!logger.should_log (spdlog::level::trace))
+			{
+				return; // Avoid constructing arguments when filtered out
+			}
+
+			if (global_trace_recorder)
+			{
+				auto & os = global_trace_recorder->begin_event ();
+				os << nano::streamed_args (global_tracing_config, std::forward<Args> (args)...);
+				global_trace_recorder->end_event (type, detail);
+				return;
+			}
+
 			// Include info about precise time of the event
 			auto now = std::chrono::high_resolution_clock::now ();
 
 			// TODO: Improve code indentation config
-			auto & logger = get_logger (type, detail);
 			logger.trace ("{}",
 			nano::streamed_args (global_tracing_config,
 			nano::log::arg{ "event", event_formatter{ type, detail } },
@@ -250,6 +307,7 @@ private:
 	nano::log::level find_level (nano::log::logger_id) const;
 
 	static spdlog::level::level_enum to_spdlog_level (nano::log::level);
+	static spdlog::async_overflow_policy to_spdlog_overflow_policy (nano::log::overflow_policy);
 };
 
 /**
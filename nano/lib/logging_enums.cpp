@@ -81,4 +81,27 @@ nano::log::tracing_format nano::log::parse_tracing_format (std::string_view name
 const std::vector<nano::log::tracing_format> & nano::log::all_tracing_formats ()
 {
 	return nano::enum_util::values<nano::log::tracing_format> ();
-}
\ No newline at end of file
+}
+
+std::string_view nano::log::to_string (nano::log::overflow_policy policy)
+{
+	return nano::enum_util::name (policy);
+}
+
+nano::log::overflow_policy nano::log::parse_overflow_policy (std::string_view name)
+{
+	auto value = nano::enum_util::try_parse<nano::log::overflow_policy> (name);
+	if (value.has_value ())
+	{
+		return value.value ();
+	}
+	auto all_policies_str = nano::util::join (nano::log::all_overflow_policies (), ", ", [] (auto const & policy) {
+		return to_string (policy);
+	});
+	throw std::invalid_argument ("Invalid overflow policy: " + std::string (name) + ". Must be one of: " + all_policies_str);
+}
+
+const std::vector<nano::log::overflow_policy> & nano::log::all_overflow_policies ()
+{
+	return nano::enum_util::values<nano::log::overflow_policy> ();
+}
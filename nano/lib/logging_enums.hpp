@@ -82,6 +82,7 @@ enum class type
 	message_processor,
 	local_block_broadcaster,
 	monitor,
+	snapshot,
 
 	// bootstrap
 	bulk_pull_client,
@@ -180,6 +181,14 @@ enum class tracing_format
 {
 	standard,
 	json,
+	binary, // Recorded into memory mapped ring files, decoded offline with `nano_node --debug_trace_decode`
+};
+
+/// What the async logging backend does when its queue is full
+enum class overflow_policy
+{
+	block, // Block the logging thread until there is room in the queue
+	drop, // Overwrite the oldest queued message
 };
 }
 
@@ -204,6 +213,11 @@ std::vector<nano::log::type> const & all_types ();
 std::string_view to_string (nano::log::tracing_format);
 nano::log::tracing_format parse_tracing_format (std::string_view);
 std::vector<nano::log::tracing_format> const & all_tracing_formats ();
+
+std::string_view to_string (nano::log::overflow_policy);
+/// @throw std::invalid_argument if the input string does not match a log::overflow_policy
+nano::log::overflow_policy parse_overflow_policy (std::string_view);
+std::vector<nano::log::overflow_policy> const & all_overflow_policies ();
 }
 
 // Ensure that the enum_range is large enough to hold all values (including future ones)
@@ -15,13 +15,11 @@ nano::network_filter::network_filter (size_t size_a, epoch_t age_cutoff_a) :
 void nano::network_filter::update (epoch_t epoch_inc)
 {
 	debug_assert (epoch_inc > 0);
-	nano::lock_guard<nano::mutex> lock{ mutex };
 	current_epoch += epoch_inc;
 }
 
 bool nano::network_filter::compare (entry const & existing, digest_t const & digest) const
 {
-	debug_assert (!mutex.try_lock ());
 	// Only consider digests to be the same if the epoch is within the age cutoff
 	return existing.digest == digest && existing.epoch + age_cutoff >= current_epoch;
 }
@@ -39,9 +37,10 @@ bool nano::network_filter::apply (uint8_t const * bytes_a, size_t count_a, nano:
 
 bool nano::network_filter::apply (digest_t const & digest)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
+	auto const index_l = index (digest);
+	nano::lock_guard<nano::mutex> lock{ mutex_for (index_l) };
 
-	auto & element = get_element (digest);
+	auto & element = items[index_l];
 	bool existed = compare (element, digest);
 	if (!existed)
 	{
@@ -58,15 +57,16 @@ bool nano::network_filter::check (uint8_t const * bytes, size_t count) const
 
 bool nano::network_filter::check (digest_t const & digest) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto & element = get_element (digest);
-	return compare (element, digest);
+	auto const index_l = index (digest);
+	nano::lock_guard<nano::mutex> lock{ mutex_for (index_l) };
+	return compare (items[index_l], digest);
 }
 
 void nano::network_filter::clear (digest_t const & digest)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto & element = get_element (digest);
+	auto const index_l = index (digest);
+	nano::lock_guard<nano::mutex> lock{ mutex_for (index_l) };
+	auto & element = items[index_l];
 	if (compare (element, digest))
 	{
 		element = { 0 };
@@ -75,14 +75,9 @@ void nano::network_filter::clear (digest_t const & digest)
 
 void nano::network_filter::clear (std::vector<digest_t> const & digests)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
 	for (auto const & digest : digests)
 	{
-		auto & element = get_element (digest);
-		if (compare (element, digest))
-		{
-			element = { 0 };
-		}
+		clear (digest);
 	}
 }
 
@@ -99,8 +94,14 @@ void nano::network_filter::clear (OBJECT const & object_a)
 
 void nano::network_filter::clear ()
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	items.assign (items.size (), { 0 });
+	for (std::size_t i = 0; i < stripe_count; ++i)
+	{
+		nano::lock_guard<nano::mutex> lock{ stripes[i].mutex };
+		for (auto index_l = i; index_l < items.size (); index_l += stripe_count)
+		{
+			items[index_l] = { 0 };
+		}
+	}
 }
 
 template <typename OBJECT>
@@ -114,20 +115,15 @@ nano::uint128_t nano::network_filter::hash (OBJECT const & object_a) const
 	return hash (bytes.data (), bytes.size ());
 }
 
-auto nano::network_filter::get_element (nano::uint128_t const & hash_a) -> entry &
+std::size_t nano::network_filter::index (nano::uint128_t const & hash_a) const
 {
-	debug_assert (!mutex.try_lock ());
 	debug_assert (items.size () > 0);
-	size_t index (hash_a % items.size ());
-	return items[index];
+	return static_cast<std::size_t> (hash_a % items.size ());
 }
 
-auto nano::network_filter::get_element (nano::uint128_t const & hash_a) const -> entry const &
+nano::mutex & nano::network_filter::mutex_for (std::size_t index_a) const
 {
-	debug_assert (!mutex.try_lock ());
-	debug_assert (items.size () > 0);
-	size_t index (hash_a % items.size ());
-	return items[index];
+	return stripes[index_a % stripe_count].mutex;
 }
 
 nano::uint128_t nano::network_filter::hash (uint8_t const * bytes_a, size_t count_a) const
@@ -1,18 +1,22 @@
 
 #pragma once
 
+#include <nano/lib/locks.hpp>
 #include <nano/lib/numbers.hpp>
 
 #include <cryptopp/seckey.h>
 #include <cryptopp/siphash.h>
 
+#include <array>
+#include <atomic>
+
 namespace nano
 {
 /**
  * A probabilistic duplicate filter based on directed map caches, using SipHash 2/4/128
  * The probability of false negatives (unique packet marked as duplicate) is the probability of a 128-bit SipHash collision.
  * The probability of false positives (duplicate packet marked as unique) shrinks with a larger filter.
- * @note This class is thread-safe.
+ * @note This class is thread-safe. Elements are guarded by a fixed set of mutexes striped by element index, so concurrent callers only contend when their digests land on the same stripe.
  */
 class network_filter final
 {
@@ -85,13 +89,11 @@ public:
 
 private:
 	epoch_t const age_cutoff;
-	epoch_t current_epoch{ 0 };
+	std::atomic<epoch_t> current_epoch{ 0 };
 
 	using siphash_t = CryptoPP::SipHash<2, 4, true>;
 	CryptoPP::SecByteBlock key{ siphash_t::KEYLENGTH };
 
-	mutable nano::mutex mutex{ mutex_identifier (mutexes::network_filter) };
-
 private:
 	struct entry
 	{
@@ -101,14 +103,21 @@ private:
 
 	std::vector<entry> items;
 
-	/**
-	 * Get element from digest.
-	 * @note must have a lock on mutex
-	 * @return a reference to the element with key \p hash_a
-	 **/
-	entry & get_element (digest_t const & hash);
-	entry const & get_element (digest_t const & hash) const;
+	// Padded to a cache line so threads locking neighbouring stripes do not contend
+	struct alignas (64) stripe
+	{
+		mutable nano::mutex mutex{ mutex_identifier (mutexes::network_filter) };
+	};
+
+	static std::size_t constexpr stripe_count{ 64 };
+	std::array<stripe, stripe_count> stripes;
+
+	/** @return index of the element for \p digest */
+	std::size_t index (digest_t const & digest) const;
+	/** @return mutex guarding the element at \p index */
+	nano::mutex & mutex_for (std::size_t index) const;
 
+	/** @note must have a lock on the mutex of \p existing */
 	bool compare (entry const & existing, digest_t const & digest) const;
 };
 }
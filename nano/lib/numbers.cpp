@@ -5,6 +5,8 @@
 #include <nano/lib/utility.hpp>
 #include <nano/secure/common.hpp>
 
+#include <boost/endian/conversion.hpp>
+
 #include <crypto/ed25519-donna/ed25519.h>
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
@@ -473,6 +475,15 @@ nano::uint128_t nano::uint128_union::number () const
 	return result;
 }
 
+nano::uint128_native_t nano::uint128_union::number_native () const
+{
+#ifdef __SIZEOF_INT128__
+	return (static_cast<nano::uint128_native_t> (boost::endian::big_to_native (qwords[0])) << 64) | boost::endian::big_to_native (qwords[1]);
+#else
+	return number ();
+#endif
+}
+
 void nano::uint128_union::encode_hex (std::string & text) const
 {
 	debug_assert (text.empty ());
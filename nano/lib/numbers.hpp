@@ -13,6 +13,15 @@ namespace nano
 using uint128_t = boost::multiprecision::uint128_t;
 using uint256_t = boost::multiprecision::uint256_t;
 using uint512_t = boost::multiprecision::uint512_t;
+/**
+ * Native 128 bit integer for amount and weight arithmetic in hot loops (vote tallies, rep weights, bucket selection)
+ * Falls back to `nano::uint128_t` when the compiler has no `unsigned __int128`. Parsing, formatting and serialization keep using `nano::uint128_t`
+ */
+#ifdef __SIZEOF_INT128__
+using uint128_native_t = unsigned __int128;
+#else
+using uint128_native_t = boost::multiprecision::uint128_t;
+#endif
 // SI dividers
 nano::uint128_t const Gxrb_ratio = nano::uint128_t ("1000000000000000000000000000000000"); // 10^33
 nano::uint128_t const Mxrb_ratio = nano::uint128_t ("1000000000000000000000000000000"); // 10^30
@@ -43,6 +52,7 @@ public:
 	std::string format_balance (nano::uint128_t scale, int precision, bool group_digits) const;
 	std::string format_balance (nano::uint128_t scale, int precision, bool group_digits, std::locale const & locale) const;
 	nano::uint128_t number () const;
+	nano::uint128_native_t number_native () const;
 	void clear ();
 	bool is_zero () const;
 	std::string to_string () const;
@@ -57,6 +67,16 @@ public:
 };
 static_assert (std::is_nothrow_move_constructible<uint128_union>::value, "uint128_union should be noexcept MoveConstructible");
 
+inline nano::uint128_native_t to_native (nano::uint128_t const & value)
+{
+	return static_cast<nano::uint128_native_t> (value);
+}
+
+inline nano::uint128_t from_native (nano::uint128_native_t value)
+{
+	return nano::uint128_t{ value };
+}
+
 // Balances are 128 bit.
 class amount : public uint128_union
 {
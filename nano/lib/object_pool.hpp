@@ -0,0 +1,268 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/memory.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+/** Allocation counters shared by all pools serving objects of type `Tag` */
+template <typename Tag>
+class object_pool_stats final
+{
+public:
+	static inline std::atomic<uint64_t> hits{ 0 }; // Allocations served from a pool
+	static inline std::atomic<uint64_t> misses{ 0 }; // Allocations which had to use the global allocator
+
+	static std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name)
+	{
+		auto composite = std::make_unique<container_info_composite> (name);
+		composite->add_component (std::make_unique<container_info_leaf> (container_info{ "hits", hits.load (), 0 }));
+		composite->add_component (std::make_unique<container_info_leaf> (container_info{ "misses", misses.load (), 0 }));
+		return composite;
+	}
+};
+
+/**
+ * Pool of fixed size memory blocks for objects of type `Tag`, with a per thread cache of free blocks
+ * Allocations and deallocations only touch the thread cache, which exchanges blocks with a shared list in batches when it runs empty or full.
+ * Blocks always come from the global allocator, so memory from a pool can safely be released with `::operator delete` and the other way around.
+ * The shared list keeps at most `shared_limit` free blocks, anything above that is returned to the global allocator so a burst of allocations does not stay reserved.
+ * Disabled when memory pools are disabled with `nano::set_use_memory_pools`
+ */
+template <typename Tag, std::size_t Size = sizeof (Tag)>
+class object_pool final
+{
+public:
+	static std::size_t constexpr cache_size = 256;
+	static std::size_t constexpr batch_size = cache_size / 2;
+	static std::size_t constexpr shared_limit = cache_size * 16;
+
+	static void * allocate ()
+	{
+		if (auto * cache = local_cache ())
+		{
+			if (cache->items.empty ())
+			{
+				refill (*cache);
+			}
+			if (!cache->items.empty ())
+			{
+				auto result = cache->items.back ();
+				cache->items.pop_back ();
+				object_pool_stats<Tag>::hits.fetch_add (1, std::memory_order_relaxed);
+				return result;
+			}
+		}
+		object_pool_stats<Tag>::misses.fetch_add (1, std::memory_order_relaxed);
+		return ::operator new (Size);
+	}
+
+	static void deallocate (void * ptr)
+	{
+		if (auto * cache = local_cache ())
+		{
+			if (cache->items.size () >= cache_size)
+			{
+				spill (*cache);
+			}
+			cache->items.push_back (ptr);
+		}
+		else
+		{
+			::operator delete (ptr);
+		}
+	}
+
+	/** Number of free blocks held in the shared list */
+	static std::size_t shared_size ()
+	{
+		if (shared_destroyed)
+		{
+			return 0;
+		}
+		auto & list = shared ();
+		nano::lock_guard<nano::mutex> guard{ list.mutex };
+		return list.items.size ();
+	}
+
+private:
+	struct local_list
+	{
+		local_list ()
+		{
+			items.reserve (cache_size);
+		}
+		~local_list ()
+		{
+			local_destroyed = true;
+			while (!items.empty ())
+			{
+				spill (*this);
+			}
+		}
+		std::vector<void *> items;
+	};
+
+	struct shared_list
+	{
+		~shared_list ()
+		{
+			shared_destroyed = true;
+			for (auto item : items)
+			{
+				::operator delete (item);
+			}
+		}
+		nano::mutex mutex;
+		std::vector<void *> items;
+	};
+
+	static local_list * local_cache ()
+	{
+		// Objects may be released during thread or static destruction, after the cache is gone
+		if (!nano::get_use_memory_pools () || local_destroyed)
+		{
+			return nullptr;
+		}
+		thread_local local_list cache;
+		return &cache;
+	}
+
+	static shared_list & shared ()
+	{
+		static shared_list list;
+		return list;
+	}
+
+	static void refill (local_list & cache)
+	{
+		if (shared_destroyed)
+		{
+			return;
+		}
+		auto & list = shared ();
+		nano::lock_guard<nano::mutex> guard{ list.mutex };
+		auto const count = std::min (batch_size, list.items.size ());
+		cache.items.insert (cache.items.end (), list.items.end () - count, list.items.end ());
+		list.items.resize (list.items.size () - count);
+	}
+
+	static void spill (local_list & cache)
+	{
+		auto const count = std::min (batch_size, cache.items.size ());
+		auto const begin = cache.items.end () - count;
+		auto kept = begin;
+		if (!shared_destroyed)
+		{
+			auto & list = shared ();
+			nano::lock_guard<nano::mutex> guard{ list.mutex };
+			auto const room = shared_limit - std::min (shared_limit, list.items.size ());
+			kept = begin + std::min (count, room);
+			list.items.insert (list.items.end (), begin, kept);
+		}
+		// Blocks which do not fit into the shared list go back to the global allocator
+		std::for_each (kept, cache.items.end (), [] (void * item) { ::operator delete (item); });
+		cache.items.resize (cache.items.size () - count);
+	}
+
+	static inline thread_local bool local_destroyed{ false };
+	static inline bool shared_destroyed{ false };
+};
+
+/**
+ * Allocator drawing single objects from an `object_pool`, for use with `std::allocate_shared`
+ * Pools are selected by `Tag` and the size of the rebound type, so the shared pointer control block and the object share one pooled block
+ */
+template <typename T, typename Tag = T>
+class object_pool_allocator final
+{
+public:
+	using value_type = T;
+
+	template <typename U>
+	struct rebind
+	{
+		using other = object_pool_allocator<U, Tag>;
+	};
+
+	object_pool_allocator () = default;
+
+	template <typename U>
+	object_pool_allocator (object_pool_allocator<U, Tag> const &)
+	{
+	}
+
+	T * allocate (std::size_t count)
+	{
+		static_assert (alignof (T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+		if (count == 1)
+		{
+			return static_cast<T *> (object_pool<Tag, sizeof (T)>::allocate ());
+		}
+		return static_cast<T *> (::operator new (count * sizeof (T)));
+	}
+
+	void deallocate (T * ptr, std::size_t count)
+	{
+		if (count == 1)
+		{
+			object_pool<Tag, sizeof (T)>::deallocate (ptr);
+		}
+		else
+		{
+			::operator delete (ptr);
+		}
+	}
+
+	template <typename U>
+	bool operator== (object_pool_allocator<U, Tag> const &) const
+	{
+		return true;
+	}
+};
+
+/** Creates a shared object from the thread caching pool for objects of type `T` */
+template <typename T, typename... Args>
+std::shared_ptr<T> make_pooled (Args &&... args)
+{
+	return std::allocate_shared<T> (object_pool_allocator<T> (), std::forward<Args> (args)...);
+}
+
+/**
+ * Base class routing `new` and `delete` of the final class `T` to its thread caching pool
+ * Works with `std::unique_ptr` of a polymorphic base, the deleting destructor of `T` picks up the matching `operator delete`
+ */
+template <typename T>
+class pooled
+{
+public:
+	static void * operator new (std::size_t size)
+	{
+		if (size != sizeof (T))
+		{
+			return ::operator new (size);
+		}
+		return object_pool<T>::allocate ();
+	}
+
+	static void operator delete (void * ptr, std::size_t size)
+	{
+		if (size != sizeof (T))
+		{
+			::operator delete (ptr);
+			return;
+		}
+		object_pool<T>::deallocate (ptr);
+	}
+};
+}
@@ -13,11 +13,11 @@ nano::rate::token_bucket::token_bucket (std::size_t max_token_count_a, std::size
 	reset (max_token_count_a, refill_rate_a);
 }
 
-bool nano::rate::token_bucket::try_consume (unsigned tokens_required_a)
+bool nano::rate::token_bucket::try_consume (unsigned tokens_required_a, std::size_t tokens_reserved_a)
 {
 	debug_assert (tokens_required_a <= 1e9);
 	refill ();
-	bool possible = current_size >= tokens_required_a;
+	bool possible = current_size >= tokens_required_a + tokens_reserved_a;
 	if (possible)
 	{
 		current_size -= tokens_required_a;
@@ -33,6 +33,13 @@ bool nano::rate::token_bucket::try_consume (unsigned tokens_required_a)
 	return possible || refill_rate == unlimited_rate_sentinel;
 }
 
+void nano::rate::token_bucket::consume (unsigned tokens_required_a)
+{
+	refill ();
+	current_size -= std::min<std::size_t> (current_size, tokens_required_a);
+	smallest_size = std::min (smallest_size, current_size);
+}
+
 void nano::rate::token_bucket::refill ()
 {
 	auto now (std::chrono::steady_clock::now ());
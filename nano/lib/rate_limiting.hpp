@@ -33,8 +33,15 @@ public:
 	 * bucket if that's the case.
 	 * The default cost is 1 token, but resource intensive operations may request
 	 * more tokens to be available.
+	 * The operation is only possible if at least \p tokens_reserved tokens remain afterwards.
 	 */
-	bool try_consume (unsigned tokens_required = 1);
+	bool try_consume (unsigned tokens_required = 1, std::size_t tokens_reserved = 0);
+
+	/**
+	 * Deduct \p tokens_required for an operation which happens regardless of the limit,
+	 * the bucket is left empty if there are not enough tokens.
+	 */
+	void consume (unsigned tokens_required);
 
 	/** Returns the largest burst observed */
 	std::size_t largest_burst () const;
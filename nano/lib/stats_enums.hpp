@@ -18,6 +18,7 @@ enum class type
 	message,
 	block,
 	ledger,
+	block_filter,
 	rollback,
 	bootstrap,
 	network,
@@ -67,6 +68,7 @@ enum class type
 	bootstrap_ascending_reply,
 	bootstrap_ascending_next,
 	bootstrap_ascending_frontiers,
+	bootstrap_ascending_peers,
 	bootstrap_server,
 	bootstrap_server_request,
 	bootstrap_server_overfill,
@@ -95,6 +97,7 @@ enum class type
 	message_processor,
 	message_processor_overfill,
 	message_processor_type,
+	bandwidth_limiter,
 
 	_last // Must be the last enum
 };
@@ -130,6 +133,7 @@ enum class detail
 	rebroadcast,
 	queue_overflow,
 	triggered,
+	stale,
 	notify,
 	duplicate,
 	confirmed,
@@ -154,6 +158,10 @@ enum class detail
 	active_conf_height,
 	inactive_conf_height,
 
+	// block_filter
+	filtered,
+	false_positive,
+
 	// ledger, block, bootstrap
 	send,
 	receive,
@@ -177,6 +185,10 @@ enum class detail
 	representative_mismatch,
 	block_position,
 
+	// ledger counters
+	counters_verified,
+	counters_mismatch,
+
 	// blockprocessor
 	process_blocking,
 	process_blocking_timeout,
@@ -394,6 +406,9 @@ enum class detail
 	channel_full,
 	frontiers,
 	account_info,
+	cache_hit,
+	cache_miss,
+	cache_stale,
 
 	// backlog
 	activated,
@@ -444,6 +459,14 @@ enum class detail
 	timestamp_reset,
 	process_frontiers,
 	dropped_frontiers,
+	pipeline,
+	staged,
+	staged_flushed,
+	staged_dropped,
+
+	// bootstrap_ascending_peers
+	window_increase,
+	window_decrease,
 
 	// bootstrap_ascending_accounts
 	prioritize,
@@ -544,6 +567,11 @@ enum class detail
 	blocks_by_account,
 	account_info_by_hash,
 
+	// bandwidth_limiter
+	sent,
+	dropped,
+	borrowed,
+
 	_last // Must be the last enum
 };
 
@@ -561,8 +589,13 @@ enum class sample
 	_invalid = 0, // Default value, should not be used
 
 	active_election_duration,
+	active_elections_tick,
 	bootstrap_tag_duration,
+	bootstrap_server_blocks_time,
+	bootstrap_server_account_info_time,
+	bootstrap_server_frontiers_time,
 	rep_response_time,
+	unchecked_dependency_time,
 
 	_last // Must be the last enum
 };
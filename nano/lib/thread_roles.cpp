@@ -19,6 +19,9 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::io:
 			thread_role_name_string = "I/O";
 			break;
+		case nano::thread_role::name::io_shard:
+			thread_role_name_string = "I/O shard";
+			break;
 		case nano::thread_role::name::io_daemon:
 			thread_role_name_string = "I/O (daemon)";
 			break;
@@ -100,6 +103,9 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::vote_generator_queue:
 			thread_role_name_string = "Voting que";
 			break;
+		case nano::thread_role::name::vote_generator_signing:
+			thread_role_name_string = "Voting sign";
+			break;
 		case nano::thread_role::name::ascending_bootstrap:
 			thread_role_name_string = "Ascboot";
 			break;
@@ -163,6 +169,12 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::monitor:
 			thread_role_name_string = "Monitor";
 			break;
+		case nano::thread_role::name::log_writer:
+			thread_role_name_string = "Log writer";
+			break;
+		case nano::thread_role::name::block_filter:
+			thread_role_name_string = "Block filter";
+			break;
 		default:
 			debug_assert (false && "nano::thread_role::get_string unhandled thread role");
 	}
@@ -11,6 +11,7 @@ enum class name
 {
 	unknown,
 	io,
+	io_shard,
 	io_daemon,
 	work,
 	message_processing,
@@ -38,6 +39,7 @@ enum class name
 	unchecked,
 	backlog_population,
 	vote_generator_queue,
+	vote_generator_signing,
 	bootstrap_server,
 	telemetry,
 	ascending_bootstrap,
@@ -61,6 +63,8 @@ enum class name
 	stats,
 	vote_router,
 	monitor,
+	log_writer,
+	block_filter,
 };
 
 std::string_view to_string (name);
@@ -5,6 +5,11 @@
 
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 /*
  * thread_attributes
  */
@@ -30,6 +35,38 @@ unsigned nano::hardware_concurrency ()
 	return concurrency;
 }
 
+bool nano::pin_current_thread (unsigned cpu)
+{
+#if defined(__linux__)
+	cpu_set_t cpus;
+	CPU_ZERO (&cpus);
+	CPU_SET (cpu, &cpus);
+	return pthread_setaffinity_np (pthread_self (), sizeof (cpus), &cpus) != 0;
+#else
+	return true; // Not supported
+#endif
+}
+
+std::vector<unsigned> nano::allowed_cpus ()
+{
+	std::vector<unsigned> result;
+#if defined(__linux__)
+	cpu_set_t cpus;
+	CPU_ZERO (&cpus);
+	if (sched_getaffinity (0, sizeof (cpus), &cpus) == 0)
+	{
+		for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+		{
+			if (CPU_ISSET (cpu, &cpus))
+			{
+				result.push_back (cpu);
+			}
+		}
+	}
+#endif
+	return result;
+}
+
 bool nano::join_or_pass (std::thread & thread)
 {
 	if (thread.joinable ())
@@ -5,6 +5,7 @@
 #include <boost/thread/thread.hpp>
 
 #include <thread>
+#include <vector>
 
 namespace nano
 {
@@ -18,6 +19,18 @@ namespace thread_attributes
  */
 unsigned hardware_concurrency ();
 
+/**
+ * Restricts the calling thread to run on logical processor core \p cpu
+ * @return true if the affinity could not be set or setting it is not supported on this platform
+ */
+bool pin_current_thread (unsigned cpu);
+
+/**
+ * Logical processor cores the calling thread may run on, as restricted by the affinity mask or cpuset of the process
+ * @return empty if the affinity mask could not be read or reading it is not supported on this platform
+ */
+std::vector<unsigned> allowed_cpus ();
+
 /**
  * If thread is joinable joins it, otherwise does nothing
  * Returns thread.joinable()
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <nano/lib/utility.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Hierarchical timer wheel holding values due at a tick in the future
+ * Each level has `slot_count` slots, a slot on level N spans `slot_count^N` ticks. Values are placed on the lowest level able to hold their deadline
+ * and are moved down a level whenever the lower level wraps around, so advancing the wheel only touches values which are (close to) due.
+ * Values are never removed before they are due, owners are expected to discard stale values themselves.
+ * Not thread safe.
+ */
+template <typename T>
+class timer_wheel final
+{
+public:
+	using value_t = T;
+	using item_t = std::pair<uint64_t, value_t>; // Deadline tick, value
+
+	static std::size_t constexpr slot_bits = 6;
+	static std::size_t constexpr slot_count = std::size_t{ 1 } << slot_bits;
+	static std::size_t constexpr level_count = 4;
+
+	explicit timer_wheel (uint64_t current_a = 0) :
+		current_m{ current_a }
+	{
+	}
+
+	/**
+	 * Schedules `value` to be returned once the wheel advances to `deadline`
+	 * Deadlines at or before the current tick are returned on the next advance
+	 */
+	void insert (uint64_t deadline, value_t value)
+	{
+		place (item_t{ std::max (deadline, current_m + 1), std::move (value) });
+		++size_m;
+	}
+
+	/**
+	 * Advances the wheel to `tick`, appending all values with a deadline at or before it to `due` in deadline order
+	 */
+	void advance (uint64_t tick, std::vector<item_t> & due)
+	{
+		while (current_m < tick)
+		{
+			if (size_m == 0)
+			{
+				current_m = tick; // Nothing scheduled, skip ahead
+				break;
+			}
+			++current_m;
+			// Move values from higher levels down when the levels below wrap around, highest level first
+			for (auto level = level_count - 1; level > 0; --level)
+			{
+				if ((current_m & ((uint64_t{ 1 } << (slot_bits * level)) - 1)) == 0)
+				{
+					cascade (level);
+				}
+			}
+			auto & slot = levels[0][current_m & (slot_count - 1)];
+			size_m -= slot.size ();
+			std::move (slot.begin (), slot.end (), std::back_inserter (due));
+			slot.clear ();
+		}
+	}
+
+	uint64_t current () const
+	{
+		return current_m;
+	}
+
+	std::size_t size () const
+	{
+		return size_m;
+	}
+
+	bool empty () const
+	{
+		return size_m == 0;
+	}
+
+	void clear ()
+	{
+		for (auto & level : levels)
+		{
+			for (auto & slot : level)
+			{
+				slot.clear ();
+			}
+		}
+		size_m = 0;
+	}
+
+private:
+	void place (item_t && item)
+	{
+		debug_assert (item.first > current_m);
+		auto const delta = item.first - current_m;
+		std::size_t level = 0;
+		while (level < level_count - 1 && delta >= (uint64_t{ 1 } << (slot_bits * (level + 1))))
+		{
+			++level;
+		}
+		// Deadlines beyond the top level wrap around and are placed again once their slot comes up
+		levels[level][(item.first >> (slot_bits * level)) & (slot_count - 1)].push_back (std::move (item));
+	}
+
+	void cascade (std::size_t level)
+	{
+		std::vector<item_t> items;
+		items.swap (levels[level][(current_m >> (slot_bits * level)) & (slot_count - 1)]);
+		for (auto & item : items)
+		{
+			if (item.first == current_m)
+			{
+				levels[0][current_m & (slot_count - 1)].push_back (std::move (item));
+			}
+			else
+			{
+				place (std::move (item));
+			}
+		}
+	}
+
+private:
+	std::array<std::array<std::vector<item_t>, slot_count>, level_count> levels;
+	uint64_t current_m;
+	std::size_t size_m{ 0 };
+};
+}
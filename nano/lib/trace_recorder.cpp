@@ -0,0 +1,473 @@
+#include <nano/lib/thread_roles.hpp>
+#include <nano/lib/trace_recorder.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+/*
+ * Tokens replacing object stream formatting in the binary representation
+ * Values are written as raw text between tokens, they are not expected to contain control characters
+ */
+char constexpr token_field_name_begin = '\x01';
+char constexpr token_field_name_end = '\x02';
+char constexpr token_object_begin = '\x03';
+char constexpr token_object_end = '\x04';
+char constexpr token_array_begin = '\x05';
+char constexpr token_array_end = '\x06';
+char constexpr token_array_element = '\x07';
+char constexpr token_string_begin = '\x0e';
+char constexpr token_string_end = '\x0f';
+
+bool is_token (char c)
+{
+	return static_cast<unsigned char> (c) < 0x10;
+}
+
+uint64_t constexpr ring_magic = 0x474e495243524e4e; // "NNRCRING"
+uint32_t constexpr ring_version = 1;
+
+struct ring_header
+{
+	uint64_t magic;
+	uint32_t version;
+	uint32_t reserved;
+	uint64_t capacity; // Size of the data section following the header
+	uint64_t head; // Offset where the next event will be written
+	uint64_t tail; // Offset of the oldest event
+	uint64_t count; // Number of events stored
+	char thread_name[16];
+};
+static_assert (std::is_trivially_copyable_v<ring_header>);
+
+struct event_header
+{
+	uint32_t size; // Including this header, zero marks a wrap around
+	uint16_t type;
+	uint16_t detail;
+	uint64_t time; // Microseconds since epoch
+};
+static_assert (std::is_trivially_copyable_v<event_header>);
+
+/*
+ * Appends to a reusable string, avoids allocations once the buffer has grown to the largest event size
+ */
+class string_streambuf : public std::streambuf
+{
+public:
+	std::string buffer;
+
+protected:
+	int_type overflow (int_type ch) override
+	{
+		if (ch != traits_type::eof ())
+		{
+			buffer.push_back (static_cast<char> (ch));
+		}
+		return ch;
+	}
+
+	std::streamsize xsputn (char const * s, std::streamsize count) override
+	{
+		buffer.append (s, count);
+		return count;
+	}
+};
+
+struct thread_state
+{
+	string_streambuf streambuf;
+	std::ostream stream{ &streambuf };
+
+	uint64_t recorder_id{ 0 };
+	nano::log::trace_ring * ring{ nullptr };
+};
+
+thread_local thread_state local_state;
+}
+
+namespace nano::log
+{
+/*
+ * Single writer ring of variable sized events, stored in a memory mapped file
+ * Events are never split, when an event does not fit before the end of the ring a wrap marker is written and writing continues from the start
+ */
+class trace_ring final
+{
+public:
+	trace_ring (std::filesystem::path const & path, std::size_t size, std::string const & thread_name)
+	{
+		release_assert (size > sizeof (ring_header) + sizeof (event_header));
+
+		boost::iostreams::mapped_file_params params{ path.string () };
+		params.flags = boost::iostreams::mapped_file::readwrite;
+		params.new_file_size = size;
+		file.open (params);
+
+		header = reinterpret_cast<ring_header *> (file.data ());
+		data = file.data () + sizeof (ring_header);
+
+		*header = {};
+		header->magic = ring_magic;
+		header->version = ring_version;
+		header->capacity = size - sizeof (ring_header);
+		std::strncpy (header->thread_name, thread_name.c_str (), sizeof (header->thread_name) - 1);
+	}
+
+	void write (event_header const & event, std::string_view payload)
+	{
+		auto const capacity = header->capacity;
+		auto const size = sizeof (event_header) + payload.size ();
+		if (size > capacity / 2)
+		{
+			return; // Too large for this ring, drop
+		}
+
+		// Not enough room before the end of the ring, evict everything past the head and wrap around
+		if (header->head + size > capacity)
+		{
+			while (header->count > 0 && header->tail >= header->head)
+			{
+				evict ();
+			}
+			if (capacity - header->head >= sizeof (uint32_t))
+			{
+				uint32_t const marker = 0;
+				std::memcpy (data + header->head, &marker, sizeof (marker));
+			}
+			header->head = 0;
+		}
+
+		// Evict events overlapping the region about to be written
+		while (header->count > 0 && header->tail >= header->head && header->tail < header->head + size)
+		{
+			evict ();
+		}
+		if (header->count == 0)
+		{
+			header->tail = header->head;
+		}
+
+		event_header event_l = event;
+		event_l.size = static_cast<uint32_t> (size);
+		std::memcpy (data + header->head, &event_l, sizeof (event_l));
+		std::memcpy (data + header->head + sizeof (event_l), payload.data (), payload.size ());
+
+		header->head += size;
+		header->count += 1;
+	}
+
+private:
+	void evict ()
+	{
+		debug_assert (header->count > 0);
+
+		auto const capacity = header->capacity;
+		uint32_t size = 0;
+		if (header->tail + sizeof (uint32_t) <= capacity)
+		{
+			std::memcpy (&size, data + header->tail, sizeof (size));
+		}
+		if (size == 0) // Wrap marker or end of the ring
+		{
+			header->tail = 0;
+			return;
+		}
+		header->tail += size;
+		header->count -= 1;
+	}
+
+private:
+	boost::iostreams::mapped_file file;
+	ring_header * header;
+	char * data;
+};
+}
+
+/*
+ * trace_recorder
+ */
+
+std::atomic<uint64_t> nano::log::trace_recorder::next_id{ 1 };
+
+nano::log::trace_recorder::trace_recorder (std::filesystem::path directory_a, std::size_t ring_size_a) :
+	directory{ std::move (directory_a) },
+	ring_size{ ring_size_a },
+	id{ next_id++ }
+{
+	std::filesystem::create_directories (directory);
+}
+
+nano::log::trace_recorder::~trace_recorder ()
+{
+	// Rings are unmapped and flushed to disk by the OS
+}
+
+std::ostream & nano::log::trace_recorder::begin_event ()
+{
+	local_state.streambuf.buffer.clear ();
+	return local_state.stream;
+}
+
+void nano::log::trace_recorder::end_event (nano::log::type type, nano::log::detail detail)
+{
+	auto now = std::chrono::system_clock::now ();
+
+	event_header event{};
+	event.type = static_cast<uint16_t> (type);
+	event.detail = static_cast<uint16_t> (detail);
+	event.time = std::chrono::duration_cast<std::chrono::microseconds> (now.time_since_epoch ()).count ();
+
+	local_ring ().write (event, local_state.streambuf.buffer);
+}
+
+nano::log::trace_ring & nano::log::trace_recorder::local_ring ()
+{
+	// Fast path, ring for this thread already looked up
+	if (local_state.recorder_id == id)
+	{
+		return *local_state.ring;
+	}
+
+	std::lock_guard guard{ mutex };
+	auto & ring = rings[std::this_thread::get_id ()];
+	if (!ring)
+	{
+		auto filename = fmt::format ("trace_{:03}.bin", rings.size ());
+		ring = std::make_unique<trace_ring> (directory / filename, ring_size, nano::thread_role::get_string ());
+	}
+	local_state.recorder_id = id;
+	local_state.ring = ring.get ();
+	return *ring;
+}
+
+nano::object_stream_config const & nano::log::trace_recorder::binary_config ()
+{
+	static object_stream_config const config{
+		.field_name_begin = std::string{ token_field_name_begin },
+		.field_name_end = std::string{ token_field_name_end },
+		.field_assignment = "",
+		.field_separator = "",
+		.object_begin = std::string{ token_object_begin },
+		.object_end = std::string{ token_object_end },
+		.array_begin = std::string{ token_array_begin },
+		.array_end = std::string{ token_array_end },
+		.array_element_begin = std::string{ token_array_element },
+		.array_element_end = "",
+		.array_element_separator = "",
+		.string_begin = std::string{ token_string_begin },
+		.string_end = std::string{ token_string_end },
+		.indent = "",
+		.newline = "",
+		.precision = 4,
+	};
+	return config;
+}
+
+/*
+ * trace_decoder
+ */
+
+namespace
+{
+class payload_parser
+{
+public:
+	explicit payload_parser (std::string_view payload) :
+		payload{ payload }
+	{
+	}
+
+	void parse_fields (nano::object_stream_context & ctx, bool first)
+	{
+		while (peek () == token_field_name_begin)
+		{
+			++pos;
+			auto name = read_until (token_field_name_end);
+			expect (token_field_name_end);
+
+			ctx.begin_field (name, std::exchange (first, false));
+			parse_value (ctx);
+			ctx.end_field ();
+		}
+	}
+
+	void parse_value (nano::object_stream_context & ctx)
+	{
+		switch (peek ())
+		{
+			case token_object_begin:
+			{
+				++pos;
+				ctx.begin_object ();
+				nano::object_stream_context nested{ ctx };
+				parse_fields (nested, true);
+				expect (token_object_end);
+				ctx.end_object ();
+				break;
+			}
+			case token_array_begin:
+			{
+				++pos;
+				ctx.begin_array ();
+				nano::object_stream_context nested{ ctx };
+				bool first = true;
+				while (peek () == token_array_element)
+				{
+					++pos;
+					nested.begin_array_element (std::exchange (first, false));
+					parse_value (nested);
+					nested.end_array_element ();
+				}
+				expect (token_array_end);
+				ctx.end_array ();
+				break;
+			}
+			case token_string_begin:
+			{
+				++pos;
+				ctx.begin_string ();
+				ctx.begin_stream () << read_until (token_string_end);
+				expect (token_string_end);
+				ctx.end_string ();
+				break;
+			}
+			default:
+			{
+				// Raw value (number, bool or null), terminated by the next token
+				auto begin = pos;
+				while (pos < payload.size () && !is_token (payload[pos]))
+				{
+					++pos;
+				}
+				ctx.begin_stream () << payload.substr (begin, pos - begin);
+				break;
+			}
+		}
+	}
+
+	bool finished () const
+	{
+		return pos >= payload.size ();
+	}
+
+private:
+	char peek () const
+	{
+		return pos < payload.size () ? payload[pos] : '\0';
+	}
+
+	std::string_view read_until (char token)
+	{
+		auto end = payload.find (token, pos);
+		if (end == std::string_view::npos)
+		{
+			throw std::runtime_error ("Malformed trace event payload");
+		}
+		auto result = payload.substr (pos, end - pos);
+		pos = end;
+		return result;
+	}
+
+	void expect (char token)
+	{
+		if (peek () != token)
+		{
+			throw std::runtime_error ("Malformed trace event payload");
+		}
+		++pos;
+	}
+
+private:
+	std::string_view payload;
+	std::size_t pos{ 0 };
+};
+}
+
+nano::log::trace_decoder::trace_decoder (nano::object_stream_config const & config_a) :
+	config{ config_a }
+{
+}
+
+void nano::log::trace_decoder::decode_event (nano::log::type type, nano::log::detail detail, uint64_t time, std::string_view payload, std::ostream & os) const
+{
+	// Mirrors the field layout of `nano::logger::trace`
+	nano::object_stream_context ctx{ os, config };
+
+	ctx.begin_field ("event", true);
+	ctx.begin_string ();
+	ctx.begin_stream () << to_string (type) << "::" << to_string (detail);
+	ctx.end_string ();
+	ctx.end_field ();
+
+	ctx.begin_field ("time", false);
+	ctx.begin_stream () << time;
+	ctx.end_field ();
+
+	payload_parser parser{ payload };
+	parser.parse_fields (ctx, false);
+	if (!parser.finished ())
+	{
+		throw std::runtime_error ("Malformed trace event payload");
+	}
+}
+
+std::size_t nano::log::trace_decoder::decode (std::filesystem::path const & file, std::ostream & os) const
+{
+	std::ifstream stream{ file, std::ios::binary };
+	std::string contents{ std::istreambuf_iterator<char> (stream), std::istreambuf_iterator<char> () };
+
+	ring_header header{};
+	if (contents.size () < sizeof (header))
+	{
+		throw std::runtime_error ("Not a trace file: " + file.string ());
+	}
+	std::memcpy (&header, contents.data (), sizeof (header));
+	if (header.magic != ring_magic || header.version != ring_version || header.capacity != contents.size () - sizeof (header))
+	{
+		throw std::runtime_error ("Not a trace file: " + file.string ());
+	}
+
+	std::string_view data{ contents.data () + sizeof (header), header.capacity };
+	std::string_view thread_name{ header.thread_name, strnlen (header.thread_name, sizeof (header.thread_name)) };
+
+	std::size_t decoded = 0;
+	auto pos = header.tail;
+	while (decoded < header.count)
+	{
+		event_header event{};
+		if (pos + sizeof (event) <= data.size ())
+		{
+			std::memcpy (&event, data.data () + pos, sizeof (event));
+		}
+		if (pos + sizeof (uint32_t) > data.size () || event.size == 0) // Wrap marker or end of the ring
+		{
+			if (pos == 0)
+			{
+				throw std::runtime_error ("Corrupted trace file: " + file.string ());
+			}
+			pos = 0;
+			continue;
+		}
+		if (event.size < sizeof (event) || pos + event.size > data.size ())
+		{
+			throw std::runtime_error ("Corrupted trace file: " + file.string ());
+		}
+
+		os << "[" << thread_name << "] ";
+		decode_event (static_cast<nano::log::type> (event.type), static_cast<nano::log::detail> (event.detail), event.time, data.substr (pos + sizeof (event), event.size - sizeof (event)), os);
+		os << "\n";
+
+		pos += event.size;
+		++decoded;
+	}
+	return decoded;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <nano/lib/logging_enums.hpp>
+#include <nano/lib/object_stream.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace nano::log
+{
+class trace_ring;
+
+/**
+ * Records trace events into memory mapped ring files, one file per recording thread.
+ * Event arguments are written with the compact `binary_config ()` object stream config, which replaces all formatting with single byte tokens.
+ * Files are decoded offline back into the regular object stream text or json format with `trace_decoder`.
+ * Because the rings are memory mapped, recorded events survive a process crash.
+ */
+class trace_recorder final
+{
+public:
+	/**
+	 * @param directory Directory where ring files are created, one per recording thread
+	 * @param ring_size Size in bytes of each per thread ring file, oldest events are overwritten once full
+	 */
+	trace_recorder (std::filesystem::path directory, std::size_t ring_size);
+	~trace_recorder ();
+
+	/**
+	 * Returns a stream for writing event arguments. Must be followed by `end_event` on the same thread.
+	 * The stream is backed by a reusable thread local buffer, so recording does not allocate in the steady state.
+	 */
+	std::ostream & begin_event ();
+	void end_event (nano::log::type, nano::log::detail);
+
+	std::filesystem::path const directory;
+	std::size_t const ring_size;
+
+public:
+	/** Config that produces the compact, token delimited representation understood by `trace_decoder` */
+	static nano::object_stream_config const & binary_config ();
+
+private:
+	trace_ring & local_ring ();
+
+private:
+	uint64_t const id;
+	std::unordered_map<std::thread::id, std::unique_ptr<trace_ring>> rings;
+	std::mutex mutex;
+
+	static std::atomic<uint64_t> next_id;
+};
+
+/**
+ * Replays events recorded by `trace_recorder` using regular object stream formatting
+ */
+class trace_decoder final
+{
+public:
+	explicit trace_decoder (nano::object_stream_config const & config);
+
+	/**
+	 * Decodes a single ring file, writing events from oldest to newest, one per line
+	 * @return number of decoded events
+	 * @throw std::runtime_error if the file is not a valid trace ring file
+	 */
+	std::size_t decode (std::filesystem::path const & file, std::ostream &) const;
+
+	/** Decodes a single event payload, as written by `trace_recorder::begin_event` */
+	void decode_event (nano::log::type, nano::log::detail, uint64_t time, std::string_view payload, std::ostream &) const;
+
+private:
+	nano::object_stream_config const & config;
+};
+}
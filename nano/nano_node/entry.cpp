@@ -2,6 +2,7 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/cli.hpp>
 #include <nano/lib/thread_runner.hpp>
+#include <nano/lib/trace_recorder.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/nano_node/daemon.hpp>
 #include <nano/node/active_elections.hpp>
@@ -137,6 +138,8 @@ int main (int argc, char * const * argv)
 		("debug_unconfirmed_frontiers", "Displays the account, height (sorted), frontier and cemented frontier for all accounts which are not fully confirmed")
 		("validate_blocks,debug_validate_blocks", "Check all blocks for correct hash, signature, work value")
 		("debug_prune", "Prune accounts up to last confirmed blocks (EXPERIMENTAL)")
+		("debug_trace_decode", "Decode binary trace ring files recorded with NANO_TRACE_FORMAT=binary. Use --file to specify a ring file or a directory of ring files")
+		("trace_format", boost::program_options::value<std::string> (), "Defines output <trace_format> for --debug_trace_decode: standard (default) or json")
 		("platform", boost::program_options::value<std::string> (), "Defines the <platform> for OpenCL commands")
 		("device", boost::program_options::value<std::string> (), "Defines <device> for OpenCL command")
 		("threads", boost::program_options::value<std::string> (), "Defines <threads> count for various commands")
@@ -1920,6 +1923,52 @@ int main (int argc, char * const * argv)
 			auto node = inactive_node.node;
 			node->ledger_pruning (node_flags.block_processor_batch_size != 0 ? node_flags.block_processor_batch_size : 16 * 1024, true);
 		}
+		else if (vm.count ("debug_trace_decode"))
+		{
+			if (vm.count ("file") == 1)
+			{
+				auto format = nano::log::tracing_format::standard;
+				if (auto trace_format_it = vm.find ("trace_format"); trace_format_it != vm.end ())
+				{
+					format = nano::log::parse_tracing_format (trace_format_it->second.as<std::string> ());
+				}
+				nano::log::trace_decoder decoder{ format == nano::log::tracing_format::json ? nano::object_stream_config::json_config () : nano::object_stream_config::default_config () };
+
+				std::filesystem::path path{ vm["file"].as<std::string> () };
+				std::vector<std::filesystem::path> files;
+				if (std::filesystem::is_directory (path))
+				{
+					for (auto const & entry : std::filesystem::directory_iterator (path))
+					{
+						files.push_back (entry.path ());
+					}
+					std::sort (files.begin (), files.end ());
+				}
+				else
+				{
+					files.push_back (path);
+				}
+
+				try
+				{
+					for (auto const & file : files)
+					{
+						auto count = decoder.decode (file, std::cout);
+						std::cerr << "Decoded " << count << " events from " << file.string () << std::endl;
+					}
+				}
+				catch (std::runtime_error const & ex)
+				{
+					std::cerr << "Error: " << ex.what () << std::endl;
+					result = -1;
+				}
+			}
+			else
+			{
+				std::cerr << "Error: --file must be specified\n";
+				result = -1;
+			}
+		}
 		else if (vm.count ("debug_stacktrace"))
 		{
 			std::cout << boost::stacktrace::stacktrace ();
@@ -26,19 +26,23 @@ nano::active_elections::active_elections (nano::node & node_a, nano::confirming_
 	block_processor{ block_processor_a },
 	recently_confirmed{ config.confirmation_cache },
 	recently_cemented{ config.confirmation_history_size },
-	election_time_to_live{ node_a.network_params.network.is_dev_network () ? 0s : 2s }
+	election_time_to_live{ node_a.network_params.network.is_dev_network () ? 0s : 2s },
+	tick_interval{ node_a.network_params.network.aec_loop_interval_ms }
 {
 	count_by_behavior.fill (0); // Zero initialize array
 
 	confirming_set.batch_cemented.add ([this] (nano::confirming_set::cemented_notification const & notification) {
 		{
 			auto transaction = node.ledger.tx_begin_read ();
+			std::vector<nano::account> successors;
 			for (auto const & [block, confirmation_root] : notification.cemented)
 			{
 				transaction.refresh_if_needed ();
 
-				block_cemented_callback (transaction, block, confirmation_root);
+				block_cemented_callback (transaction, block, confirmation_root, successors);
 			}
+			// Successor accounts of the whole batch are activated at once
+			node.scheduler.priority.activate_many (transaction, std::move (successors));
 		}
 		for (auto const & hash : notification.already_cemented)
 		{
@@ -91,7 +95,7 @@ void nano::active_elections::stop ()
 	clear ();
 }
 
-void nano::active_elections::block_cemented_callback (nano::secure::transaction const & transaction, std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root)
+void nano::active_elections::block_cemented_callback (nano::secure::transaction const & transaction, std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root, std::vector<nano::account> & successors)
 {
 	debug_assert (node.block_confirmed (block->hash ()));
 
@@ -135,7 +139,7 @@ void nano::active_elections::block_cemented_callback (nano::secure::transaction
 	// Next-block activations are only done for blocks with previously active elections
 	if (cemented_bootstrap_count_reached && was_active && !node.flags.disable_activate_successors)
 	{
-		activate_successors (transaction, block);
+		activate_successors (block, successors);
 	}
 }
 
@@ -174,14 +178,14 @@ void nano::active_elections::notify_observers (nano::secure::transaction const &
 	}
 }
 
-void nano::active_elections::activate_successors (nano::secure::transaction const & transaction, std::shared_ptr<nano::block> const & block)
+void nano::active_elections::activate_successors (std::shared_ptr<nano::block> const & block, std::vector<nano::account> & successors)
 {
-	node.scheduler.priority.activate (transaction, block->account ());
+	successors.push_back (block->account ());
 
 	// Start or vote for the next unconfirmed block in the destination account
 	if (block->is_send () && !block->destination ().is_zero () && block->destination () != block->account ())
 	{
-		node.scheduler.priority.activate (transaction, block->destination ());
+		successors.push_back (block->destination ());
 	}
 }
 
@@ -275,37 +279,106 @@ void nano::active_elections::request_confirm (nano::unique_lock<nano::mutex> & l
 {
 	debug_assert (lock_a.owns_lock ());
 
-	std::size_t const this_loop_target_l (roots.size ());
-	auto const elections_l{ list_active_impl (this_loop_target_l) };
+	std::vector<std::shared_ptr<nano::election>> elections_l;
+	auto take = [&elections_l] (entry const & entry_a) {
+		entry_a.scheduled = unscheduled; // Rescheduled after processing
+		elections_l.push_back (entry_a.election);
+	};
+
+	// Elections which had an event since the last iteration
+	decltype (triggered) triggered_l;
+	{
+		nano::lock_guard<nano::mutex> guard{ triggered_mutex };
+		triggered_l.swap (triggered);
+	}
+	for (auto const & root : triggered_l)
+	{
+		auto existing = roots.get<tag_root> ().find (root);
+		if (existing != roots.get<tag_root> ().end () && existing->scheduled != unscheduled)
+		{
+			take (*existing);
+		}
+	}
+	auto const triggered_count = elections_l.size ();
+
+	// Elections with a scheduled action due, wheel entries which no longer match an election are stale
+	std::vector<decltype (wheel)::item_t> due;
+	wheel.advance (to_tick (std::chrono::steady_clock::now ()), due);
+	for (auto const & [tick, root] : due)
+	{
+		auto existing = roots.get<tag_root> ().find (root);
+		if (existing != roots.get<tag_root> ().end () && existing->scheduled == tick)
+		{
+			take (*existing);
+		}
+	}
+
+	node.stats.add (nano::stat::type::active, nano::stat::detail::triggered, triggered_count);
+	node.stats.add (nano::stat::type::active, nano::stat::detail::processed, elections_l.size ());
+	node.stats.add (nano::stat::type::active, nano::stat::detail::stale, due.size () - (elections_l.size () - triggered_count));
+	node.stats.sample (nano::stat::sample::active_elections_tick, elections_l.size (), { 0, static_cast<int64_t> (config.size) });
 
 	lock_a.unlock ();
 
 	nano::confirmation_solicitor solicitor (node.network, node.config);
 	solicitor.prepare (node.rep_crawler.principal_representatives (std::numeric_limits<std::size_t>::max ()));
 
-	std::size_t unconfirmed_count_l (0);
-	nano::timer<std::chrono::milliseconds> elapsed (nano::timer_state::started);
-
 	/*
-	 * Loop through active elections in descending order of proof-of-work difficulty, requesting confirmation
+	 * Process elections which are due, requesting confirmation and rebroadcasting blocks and votes
 	 *
-	 * Only up to a certain amount of elections are queued for confirmation request and block rebroadcasting. The remaining elections can still be confirmed if votes arrive
-	 * Elections extending the soft config.size limit are flushed after a certain time-to-live cutoff
-	 * Flushed elections are later re-activated via frontier confirmation
+	 * Only up to a certain amount of elections are queued for confirmation request and block rebroadcasting. Elections which could not be queued are due again on the next iteration
+	 * The remaining elections can still be confirmed if votes arrive
 	 */
+	std::vector<std::pair<nano::qualified_root, uint64_t>> next_l;
+	next_l.reserve (elections_l.size ());
 	for (auto const & election_l : elections_l)
 	{
-		bool const confirmed_l (election_l->confirmed ());
-		unconfirmed_count_l += !confirmed_l;
-
 		if (election_l->transition_time (solicitor))
 		{
 			erase (election_l->qualified_root);
 		}
+		else
+		{
+			// Rounded up so elections are not processed before they are due
+			next_l.emplace_back (election_l->qualified_root, to_tick (election_l->next_transition_time ()) + 1);
+		}
 	}
 
 	solicitor.flush ();
 	lock_a.lock ();
+
+	for (auto const & [root, tick] : next_l)
+	{
+		auto existing = roots.get<tag_root> ().find (root);
+		if (existing != roots.get<tag_root> ().end ())
+		{
+			schedule (*existing, tick);
+		}
+	}
+}
+
+void nano::active_elections::schedule (entry const & entry_a, uint64_t tick)
+{
+	debug_assert (!mutex.try_lock ());
+
+	// The wheel returns deadlines in the past on the next advance, keep the tick it will report
+	tick = std::max (tick, wheel.current () + 1);
+	if (tick < entry_a.scheduled)
+	{
+		entry_a.scheduled = tick;
+		wheel.insert (tick, entry_a.root);
+	}
+}
+
+uint64_t nano::active_elections::to_tick (std::chrono::steady_clock::time_point time) const
+{
+	return std::max (time - epoch, std::chrono::steady_clock::duration::zero ()) / tick_interval;
+}
+
+void nano::active_elections::trigger (nano::qualified_root const & root)
+{
+	nano::lock_guard<nano::mutex> guard{ triggered_mutex };
+	triggered.push_back (root);
 }
 
 void nano::active_elections::cleanup_election (nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election> election)
@@ -437,7 +510,9 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 				node.online_reps.observe (rep_a);
 			};
 			result.election = nano::make_shared<nano::election> (node, block_a, nullptr, observe_rep_cb, election_behavior_a);
-			roots.get<tag_root> ().emplace (entry{ root, result.election, std::move (erased_callback_a) });
+			auto [inserted, success] = roots.get<tag_root> ().emplace (entry{ root, result.election, std::move (erased_callback_a) });
+			debug_assert (success);
+			schedule (*inserted, wheel.current () + 1);
 			node.vote_router.connect (hash, result.election);
 
 			// Keep track of election count by election type
@@ -584,6 +659,11 @@ void nano::active_elections::clear ()
 	{
 		nano::lock_guard<nano::mutex> guard{ mutex };
 		roots.clear ();
+		wheel.clear ();
+	}
+	{
+		nano::lock_guard<nano::mutex> guard{ triggered_mutex };
+		triggered.clear ();
 	}
 
 	vacancy_update ();
@@ -595,6 +675,7 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (ac
 
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "roots", active_elections.roots.size (), sizeof (decltype (active_elections.roots)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "wheel", active_elections.wheel.size (), sizeof (decltype (active_elections.wheel)::item_t) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "election_winner_details", active_elections.election_winner_details_size (), sizeof (decltype (active_elections.election_winner_details)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "normal", static_cast<std::size_t> (active_elections.count_by_behavior[nano::election_behavior::priority]), 0 }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "hinted", static_cast<std::size_t> (active_elections.count_by_behavior[nano::election_behavior::hinted]), 0 }));
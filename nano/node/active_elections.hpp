@@ -2,6 +2,7 @@
 
 #include <nano/lib/enum_util.hpp>
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/timer_wheel.hpp>
 #include <nano/node/election_behavior.hpp>
 #include <nano/node/election_insertion_result.hpp>
 #include <nano/node/election_status.hpp>
@@ -78,12 +79,16 @@ public:
 	using erased_callback_t = std::function<void (std::shared_ptr<nano::election>)>;
 
 private: // Elections
+	static uint64_t constexpr unscheduled{ std::numeric_limits<uint64_t>::max () };
+
 	class entry final
 	{
 	public:
 		nano::qualified_root root;
 		std::shared_ptr<nano::election> election;
 		erased_callback_t erased_callback;
+		// Tick of the wheel entry which is currently valid for this election, older wheel entries are skipped
+		mutable uint64_t scheduled{ unscheduled };
 	};
 
 	friend class nano::election;
@@ -128,6 +133,11 @@ public:
 	std::size_t size () const;
 	std::size_t size (nano::election_behavior) const;
 	bool publish (std::shared_ptr<nano::block> const &);
+	/**
+	 * Requests the election for `root` to be processed on the next request loop iteration, instead of at its next scheduled action
+	 * Only takes a leaf mutex so it is safe to call while holding an election mutex
+	 */
+	void trigger (nano::qualified_root const &);
 
 	/**
 	 * Maximum number of elections that should be present in this container
@@ -147,14 +157,18 @@ public:
 private:
 	void request_loop ();
 	void request_confirm (nano::unique_lock<nano::mutex> &);
+	// Registers the entry in the timer wheel unless it is already due earlier, mutex must be locked
+	void schedule (entry const &, uint64_t tick);
+	uint64_t to_tick (std::chrono::steady_clock::time_point) const;
 	// Erase all blocks from active and, if not confirmed, clear digests from network filters
 	void cleanup_election (nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election>);
 	nano::stat::type completion_type (nano::election const & election) const;
 	// Returns a list of elections sorted by difficulty, mutex must be locked
 	std::vector<std::shared_ptr<nano::election>> list_active_impl (std::size_t) const;
-	void activate_successors (nano::secure::transaction const &, std::shared_ptr<nano::block> const & block);
+	/** Collects accounts whose next unconfirmed block should be activated in the priority scheduler */
+	void activate_successors (std::shared_ptr<nano::block> const & block, std::vector<nano::account> & successors);
 	void notify_observers (nano::secure::transaction const &, nano::election_status const & status, std::vector<nano::vote_with_weight_info> const & votes) const;
-	void block_cemented_callback (nano::secure::transaction const &, std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root);
+	void block_cemented_callback (nano::secure::transaction const &, std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root, std::vector<nano::account> & successors);
 	void block_already_cemented_callback (nano::block_hash const & hash);
 
 private: // Dependencies
@@ -178,6 +192,17 @@ private:
 	// Maximum time an election can be kept active if it is extending the container
 	std::chrono::seconds const election_time_to_live;
 
+	/**
+	 * Elections are registered in a timer wheel keyed by the tick of their next action, so each request loop iteration only processes elections which have something to do
+	 * A tick is one request loop interval
+	 */
+	std::chrono::steady_clock::time_point const epoch{ std::chrono::steady_clock::now () };
+	std::chrono::milliseconds const tick_interval;
+	nano::timer_wheel<nano::qualified_root> wheel;
+
+	mutable nano::mutex triggered_mutex;
+	std::vector<nano::qualified_root> triggered;
+
 	/** Keeps track of number of elections by election behavior (normal, hinted, optimistic) */
 	nano::enum_array<nano::election_behavior, int64_t> count_by_behavior{};
 
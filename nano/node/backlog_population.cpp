@@ -7,6 +7,7 @@
 #include <nano/store/account.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
+#include <nano/store/unconfirmed.hpp>
 
 nano::backlog_population::backlog_population (backlog_population_config const & config_a, nano::scheduler::component & schedulers, nano::ledger & ledger, nano::stats & stats_a) :
 	config{ config_a },
@@ -95,27 +96,38 @@ void nano::backlog_population::populate_backlog (nano::unique_lock<nano::mutex>
 		{
 			auto transaction = ledger.tx_begin_read ();
 
-			auto it = ledger.store.account.begin (transaction, next);
-			auto const end = ledger.store.account.end ();
+			// Only accounts with unconfirmed blocks are indexed, so there is no need to scan the whole accounts table
+			auto it = ledger.store.unconfirmed.begin (transaction, next);
+			auto const end = ledger.store.unconfirmed.end ();
 
 			auto should_refresh = [&transaction] () {
 				auto cutoff = std::chrono::steady_clock::now () - 100ms; // TODO: Make this configurable
 				return transaction.timestamp () < cutoff;
 			};
 
+			// Priority scheduler activations are batched per chunk to avoid taking bucket locks and notifying once per account
+			// Account info and confirmation height read here are passed along, so the scheduler does not read them again
+			std::vector<nano::scheduler::priority::account_state> batch;
 			for (size_t count = 0; it != end && count < chunk_size && !should_refresh (); ++it, ++count, ++total)
 			{
 				stats.inc (nano::stat::type::backlog, nano::stat::detail::total);
 
 				auto const & account = it->first;
-				auto const & account_info = it->second;
-
-				activate (transaction, account, account_info);
+				if (auto account_info = ledger.store.account.get (transaction, account))
+				{
+					// If conf info is empty then it means then it means nothing is confirmed yet
+					auto const conf_info = ledger.store.confirmation_height.get (transaction, account).value_or (nano::confirmation_height_info{});
+					if (activate (transaction, account, account_info.value (), conf_info))
+					{
+						batch.push_back ({ account, account_info.value (), conf_info });
+					}
+				}
 
 				next = account.number () + 1;
 			}
+			schedulers.priority.activate_many (transaction, std::move (batch));
 
-			done = ledger.store.account.begin (transaction, next) == end;
+			done = ledger.store.unconfirmed.begin (transaction, next) == end;
 		}
 
 		lock.lock ();
@@ -125,12 +137,8 @@ void nano::backlog_population::populate_backlog (nano::unique_lock<nano::mutex>
 	}
 }
 
-void nano::backlog_population::activate (secure::transaction const & transaction, nano::account const & account, nano::account_info const & account_info)
+bool nano::backlog_population::activate (secure::transaction const & transaction, nano::account const & account, nano::account_info const & account_info, nano::confirmation_height_info const & conf_info)
 {
-	auto const maybe_conf_info = ledger.store.confirmation_height.get (transaction, account);
-	auto const conf_info = maybe_conf_info.value_or (nano::confirmation_height_info{});
-
-	// If conf info is empty then it means then it means nothing is confirmed yet
 	if (conf_info.height < account_info.block_count)
 	{
 		stats.inc (nano::stat::type::backlog, nano::stat::detail::activated);
@@ -138,8 +146,9 @@ void nano::backlog_population::activate (secure::transaction const & transaction
 		activate_callback.notify (transaction, account);
 
 		schedulers.optimistic.activate (account, account_info, conf_info);
-		schedulers.priority.activate (transaction, account, account_info, conf_info);
+		return true;
 	}
+	return false;
 }
 
 /*
@@ -67,7 +67,8 @@ private:
 	void run ();
 	bool predicate () const;
 	void populate_backlog (nano::unique_lock<nano::mutex> & lock);
-	void activate (secure::transaction const &, nano::account const &, nano::account_info const &);
+	/** @return true if the account should be activated in the priority scheduler */
+	bool activate (secure::transaction const &, nano::account const &, nano::account_info const &, nano::confirmation_height_info const &);
 
 private:
 	/** This is a manual trigger, the ongoing backlog population does not use this.
@@ -1,44 +1,244 @@
+#include <nano/lib/stats.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/node/bandwidth_limiter.hpp>
 #include <nano/node/nodeconfig.hpp>
+#include <nano/node/transport/channel.hpp>
 
 /*
  * bandwidth_limiter
  */
 
-nano::bandwidth_limiter::bandwidth_limiter (nano::node_config const & node_config_a) :
+nano::bandwidth_limiter::bandwidth_limiter (nano::node_config const & node_config_a, nano::stats & stats_a) :
 	config{ node_config_a },
-	limiter_generic{ config.generic_limit, config.generic_burst_ratio },
-	limiter_bootstrap{ config.bootstrap_limit, config.bootstrap_burst_ratio }
+	stats{ stats_a },
+	class_generic{ config.generic_limit, config.generic_burst_ratio },
+	class_bootstrap{ config.bootstrap_limit, config.bootstrap_burst_ratio }
 {
 }
 
-nano::rate_limiter & nano::bandwidth_limiter::select_limiter (nano::transport::traffic_type type)
+auto nano::bandwidth_limiter::select_class (nano::transport::traffic_type type) -> traffic_class &
 {
 	switch (type)
 	{
 		case nano::transport::traffic_type::bootstrap:
-			return limiter_bootstrap;
+			return class_bootstrap;
 		case nano::transport::traffic_type::generic:
-			return limiter_generic;
+			return class_generic;
 			break;
 		default:
 			debug_assert (false, "missing traffic type");
 			break;
 	}
-	return limiter_generic;
+	return class_generic;
 }
 
-bool nano::bandwidth_limiter::should_pass (std::size_t buffer_size, nano::transport::traffic_type type)
+bool nano::bandwidth_limiter::should_pass (std::size_t buffer_size, nano::transport::traffic_type type, nano::transport::channel const * channel, nano::transport::buffer_drop_policy policy)
 {
-	auto & limiter = select_limiter (type);
-	return limiter.should_pass (buffer_size);
+	auto & traffic = select_class (type);
+	auto const size = nano::narrow_cast<unsigned int> (buffer_size);
+	bool const droppable = policy == nano::transport::buffer_drop_policy::limiter;
+	// Unlimited traffic types and traffic not tied to a channel skip per channel accounting
+	if (traffic.limit == 0 || channel == nullptr)
+	{
+		return traffic.consume (size, 0, droppable);
+	}
+
+	bool pass = false;
+	bool borrowed = false;
+	{
+		auto const now = std::chrono::steady_clock::now ();
+		auto & shard = traffic.select_shard (*channel);
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		if (now - shard.last_cleanup >= std::chrono::seconds{ 1 })
+		{
+			cleanup (traffic, shard, now);
+		}
+
+		auto & entry = peer (traffic, shard, *channel, now);
+		traffic.refill (entry, now);
+		entry.last_used = now;
+		bool const within_share = entry.tokens >= size;
+		// A channel which exceeded its share may only use bandwidth which is not needed by channels within their share
+		auto const reserved = within_share ? 0 : static_cast<std::size_t> (traffic.capacity () * borrow_reserve);
+		pass = traffic.consume (size, reserved, droppable);
+		if (pass)
+		{
+			entry.tokens = std::max (entry.tokens - size, 0.0);
+			borrowed = !within_share && droppable;
+		}
+		(pass ? entry.sent_bytes : entry.dropped_bytes) += size;
+	}
+	stats.add (nano::stat::type::bandwidth_limiter, pass ? nano::stat::detail::sent : nano::stat::detail::dropped, nano::stat::dir::out, buffer_size);
+	if (borrowed)
+	{
+		stats.inc (nano::stat::type::bandwidth_limiter, nano::stat::detail::borrowed, nano::stat::dir::out);
+	}
+	return pass;
+}
+
+auto nano::bandwidth_limiter::peer (traffic_class & traffic, shard & shard, nano::transport::channel const & channel, std::chrono::steady_clock::time_point now) -> peer_entry &
+{
+	debug_assert (!shard.mutex.try_lock ());
+	auto existing = shard.peers.find (channel.id);
+	if (existing != shard.peers.end ())
+	{
+		return existing->second;
+	}
+	bool principal = false;
+	{
+		nano::lock_guard<nano::mutex> guard{ principals_mutex };
+		principal = principals.count (channel.id) > 0;
+	}
+	auto const share_l = share (principal);
+	auto const total_share = traffic.total_share += share_l;
+	auto [entry, inserted] = shard.peers.emplace (channel.id, peer_entry{ channel.get_endpoint (), share_l, principal, 0.0, now, now });
+	debug_assert (inserted);
+	// New channels start with a full share so the first messages to a peer are not delayed
+	entry->second.tokens = static_cast<double> (traffic.capacity ()) * share_l / total_share;
+	return entry->second;
+}
+
+std::size_t nano::bandwidth_limiter::share (bool principal) const
+{
+	return principal ? std::max<std::size_t> (config.pr_share, 1) : 1;
+}
+
+void nano::bandwidth_limiter::cleanup (traffic_class & traffic, shard & shard, std::chrono::steady_clock::time_point now)
+{
+	debug_assert (!shard.mutex.try_lock ());
+	shard.last_cleanup = now;
+	erase_if (shard.peers, [&traffic, now] (auto const & item) {
+		if (now - item.second.last_used > peer_timeout)
+		{
+			traffic.total_share -= item.second.share;
+			return true; // Erase
+		}
+		return false;
+	});
 }
 
 void nano::bandwidth_limiter::reset (std::size_t limit, double burst_ratio, nano::transport::traffic_type type)
 {
-	auto & limiter = select_limiter (type);
-	limiter.reset (limit, burst_ratio);
+	auto & traffic = select_class (type);
+	nano::lock_guard<nano::mutex> guard{ traffic.bucket_mutex };
+	traffic.limit = limit;
+	traffic.burst_ratio = burst_ratio;
+	traffic.bucket.reset (traffic.capacity (), limit);
+}
+
+void nano::bandwidth_limiter::set_principals (std::vector<std::shared_ptr<nano::transport::channel>> const & channels)
+{
+	std::unordered_set<nano::id_t> principals_l;
+	for (auto const & channel : channels)
+	{
+		principals_l.insert (channel->id);
+	}
+	{
+		nano::lock_guard<nano::mutex> guard{ principals_mutex };
+		principals = principals_l;
+	}
+	for (auto * traffic : { &class_generic, &class_bootstrap })
+	{
+		for (auto & shard : traffic->shards)
+		{
+			nano::lock_guard<nano::mutex> guard{ shard.mutex };
+			for (auto & [id, entry] : shard.peers)
+			{
+				entry.principal = principals_l.count (id) > 0;
+				auto const share_l = share (entry.principal);
+				traffic->total_share += share_l;
+				traffic->total_share -= entry.share;
+				entry.share = share_l;
+			}
+		}
+	}
+}
+
+auto nano::bandwidth_limiter::peers () const -> std::vector<peer_info>
+{
+	std::vector<peer_info> result;
+	for (auto const & [traffic, type] : { std::pair{ &class_generic, nano::transport::traffic_type::generic }, std::pair{ &class_bootstrap, nano::transport::traffic_type::bootstrap } })
+	{
+		for (auto const & shard : traffic->shards)
+		{
+			nano::lock_guard<nano::mutex> guard{ shard.mutex };
+			for (auto const & [id, entry] : shard.peers)
+			{
+				result.push_back ({ entry.endpoint, type, entry.principal, entry.sent_bytes, entry.dropped_bytes });
+			}
+		}
+	}
+	return result;
+}
+
+std::unique_ptr<nano::container_info_component> nano::bandwidth_limiter::collect_container_info (std::string const & name) const
+{
+	auto count_peers = [] (traffic_class const & traffic) {
+		std::size_t result = 0;
+		for (auto const & shard : traffic.shards)
+		{
+			nano::lock_guard<nano::mutex> guard{ shard.mutex };
+			result += shard.peers.size ();
+		}
+		return result;
+	};
+	std::size_t principals_count;
+	{
+		nano::lock_guard<nano::mutex> guard{ principals_mutex };
+		principals_count = principals.size ();
+	}
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "generic_peers", count_peers (class_generic), sizeof (decltype (shard::peers)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "bootstrap_peers", count_peers (class_bootstrap), sizeof (decltype (shard::peers)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "principals", principals_count, sizeof (decltype (principals)::value_type) }));
+	return composite;
+}
+
+/*
+ * traffic_class
+ */
+
+nano::bandwidth_limiter::traffic_class::traffic_class (std::size_t limit_a, double burst_ratio_a) :
+	limit{ limit_a },
+	burst_ratio{ burst_ratio_a },
+	bucket{ static_cast<std::size_t> (limit_a * burst_ratio_a), limit_a }
+{
+}
+
+std::size_t nano::bandwidth_limiter::traffic_class::capacity () const
+{
+	return static_cast<std::size_t> (limit * burst_ratio);
+}
+
+void nano::bandwidth_limiter::traffic_class::refill (peer_entry & entry, std::chrono::steady_clock::time_point now) const
+{
+	auto const total = total_share.load ();
+	debug_assert (total > 0);
+	auto const fraction = static_cast<double> (entry.share) / std::max<std::size_t> (total, 1);
+	auto const elapsed = std::chrono::duration<double> (now - entry.last_refill).count ();
+	entry.tokens = std::min (entry.tokens + elapsed * limit * fraction, capacity () * fraction);
+	entry.last_refill = now;
+}
+
+bool nano::bandwidth_limiter::traffic_class::consume (unsigned size, std::size_t reserved, bool droppable)
+{
+	nano::lock_guard<nano::mutex> guard{ bucket_mutex };
+	if (bucket.try_consume (size, reserved))
+	{
+		return true;
+	}
+	if (!droppable)
+	{
+		bucket.consume (size);
+		return true;
+	}
+	return false;
+}
+
+auto nano::bandwidth_limiter::traffic_class::select_shard (nano::transport::channel const & channel) -> shard &
+{
+	// Channel ids are random, so they spread evenly between shards
+	return shards[reinterpret_cast<std::uintptr_t> (channel.id) % shards.size ()];
 }
 
 /*
@@ -49,6 +249,7 @@ nano::bandwidth_limiter_config::bandwidth_limiter_config (nano::node_config cons
 	generic_limit{ node_config.bandwidth_limit },
 	generic_burst_ratio{ node_config.bandwidth_limit_burst_ratio },
 	bootstrap_limit{ node_config.bootstrap_bandwidth_limit },
-	bootstrap_burst_ratio{ node_config.bootstrap_bandwidth_burst_ratio }
+	bootstrap_burst_ratio{ node_config.bootstrap_bandwidth_burst_ratio },
+	pr_share{ node_config.bandwidth_limit_pr_share }
 {
-}
\ No newline at end of file
+}
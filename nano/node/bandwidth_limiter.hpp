@@ -1,11 +1,25 @@
 #pragma once
 
+#include <nano/lib/id_dispenser.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/lib/rate_limiting.hpp>
+#include <nano/node/common.hpp>
 #include <nano/node/fwd.hpp>
+#include <nano/node/transport/common.hpp>
 #include <nano/node/transport/traffic_type.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace nano
 {
+class container_info_component;
+
 class bandwidth_limiter_config final
 {
 public:
@@ -17,37 +31,114 @@ public:
 
 	std::size_t bootstrap_limit;
 	double bootstrap_burst_ratio;
+
+	/** Share of a traffic type limit given to a principal representative channel, relative to a share of 1 for other channels */
+	std::size_t pr_share;
 };
 
 /**
  * Class that tracks and manages bandwidth limits for IO operations
+ * Limits are hierarchical: each traffic type has a token bucket with the configured limit, which is further divided between channels
+ * in proportion to their share. A channel within its share only needs tokens from the traffic type bucket, a channel exceeding its share
+ * may borrow idle bandwidth as long as the traffic type bucket stays more than half full, so a single greedy peer cannot starve the rest.
+ * Channels are split between independently locked shards, only the traffic type bucket is shared by all channels of a traffic type.
  */
 class bandwidth_limiter final
 {
 public:
-	explicit bandwidth_limiter (nano::node_config const &);
+	bandwidth_limiter (nano::node_config const &, nano::stats &);
 
 	/**
 	 * Check whether packet falls withing bandwidth limits and should be allowed
+	 * When `channel` is set, the packet is also accounted against the channel share
+	 * Packets which the limiter may not drop (`policy` other than `buffer_drop_policy::limiter`) always pass, but still use up bandwidth
 	 * @return true if OK, false if needs to be dropped
 	 */
-	bool should_pass (std::size_t buffer_size, nano::transport::traffic_type type);
+	bool should_pass (std::size_t buffer_size, nano::transport::traffic_type type, nano::transport::channel const * channel = nullptr, nano::transport::buffer_drop_policy policy = nano::transport::buffer_drop_policy::limiter);
 	/**
 	 * Reset limits of selected limiter type to values passed in arguments
 	 */
 	void reset (std::size_t limit, double burst_ratio, nano::transport::traffic_type type = nano::transport::traffic_type::generic);
+	/**
+	 * Replaces the set of channels which receive the larger principal representative share
+	 */
+	void set_principals (std::vector<std::shared_ptr<nano::transport::channel>> const &);
+
+	struct peer_info
+	{
+		nano::endpoint endpoint;
+		nano::transport::traffic_type type;
+		bool principal;
+		uint64_t sent_bytes;
+		uint64_t dropped_bytes;
+	};
+	/** Per channel traffic of recently active channels */
+	std::vector<peer_info> peers () const;
+
+	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name) const;
+
+public:
+	/** Channels without traffic for this long no longer take part in dividing the limit */
+	static std::chrono::seconds constexpr peer_timeout{ 10 };
+	/** Fraction of the traffic type bucket which cannot be borrowed by channels exceeding their share */
+	static double constexpr borrow_reserve{ 0.5 };
 
 private:
+	static std::size_t constexpr shard_count = 16;
+
+	struct peer_entry
+	{
+		nano::endpoint endpoint;
+		std::size_t share;
+		bool principal;
+		double tokens;
+		std::chrono::steady_clock::time_point last_refill;
+		std::chrono::steady_clock::time_point last_used;
+		uint64_t sent_bytes{ 0 };
+		uint64_t dropped_bytes{ 0 };
+	};
+
+	struct shard
+	{
+		std::unordered_map<nano::id_t, peer_entry> peers; // Keyed by channel id
+		std::chrono::steady_clock::time_point last_cleanup{ std::chrono::steady_clock::now () };
+		mutable nano::mutex mutex;
+	};
+
+	struct traffic_class
+	{
+		traffic_class (std::size_t limit, double burst_ratio);
+
+		std::atomic<std::size_t> limit;
+		std::atomic<double> burst_ratio;
+		std::atomic<std::size_t> total_share{ 0 };
+		nano::rate::token_bucket bucket;
+		nano::mutex bucket_mutex;
+		std::array<shard, shard_count> shards;
+
+		std::size_t capacity () const;
+		void refill (peer_entry &, std::chrono::steady_clock::time_point now) const;
+		/** Takes tokens from the traffic type bucket, leaving at least `reserved` tokens. Packets which cannot be dropped always take their tokens */
+		bool consume (unsigned size, std::size_t reserved, bool droppable);
+		shard & select_shard (nano::transport::channel const &);
+	};
+
 	/**
-	 * Returns reference to limiter corresponding to the limit type
+	 * Returns reference to traffic class corresponding to the limit type
 	 */
-	nano::rate_limiter & select_limiter (nano::transport::traffic_type type);
+	traffic_class & select_class (nano::transport::traffic_type type);
+	peer_entry & peer (traffic_class &, shard &, nano::transport::channel const &, std::chrono::steady_clock::time_point now);
+	std::size_t share (bool principal) const;
+	void cleanup (traffic_class &, shard &, std::chrono::steady_clock::time_point now);
 
 private:
 	bandwidth_limiter_config const config;
+	nano::stats & stats;
 
 private:
-	nano::rate_limiter limiter_generic;
-	nano::rate_limiter limiter_bootstrap;
+	traffic_class class_generic;
+	traffic_class class_bootstrap;
+	std::unordered_set<nano::id_t> principals; // Channel ids
+	mutable nano::mutex principals_mutex;
 };
-}
\ No newline at end of file
+}
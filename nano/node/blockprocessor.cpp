@@ -132,9 +132,9 @@ bool nano::block_processor::add (std::shared_ptr<nano::block> const & block, blo
 
 	node.stats.inc (nano::stat::type::blockprocessor, nano::stat::detail::process);
 	node.logger.debug (nano::log::type::blockprocessor, "Processing block (async): {} (source: {} {})",
-	block->hash ().to_string (),
+	block->hash (),
 	to_string (source),
-	channel ? channel->to_string () : "<unknown>"); // TODO: Lazy eval
+	nano::log::lazy ([&channel] () { return channel ? channel->to_string () : "<unknown>"; }));
 
 	return add_impl (context{ block, source, std::move (callback) }, channel);
 }
@@ -319,7 +319,7 @@ auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock
 
 	lock.unlock ();
 
-	auto transaction = node.ledger.tx_begin_write ({ tables::accounts, tables::blocks, tables::pending, tables::rep_weights }, nano::store::writer::blockprocessor);
+	auto transaction = node.ledger.tx_begin_write ({ tables::accounts, tables::blocks, tables::meta, tables::pending, tables::rep_weights, tables::unconfirmed }, nano::store::writer::blockprocessor);
 
 	nano::timer<std::chrono::milliseconds> timer;
 	timer.start ();
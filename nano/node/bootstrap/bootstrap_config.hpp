@@ -48,8 +48,10 @@ public:
 	bool enable_database_scan{ false };
 	bool enable_dependency_walker{ true };
 	bool enable_frontier_scan{ true };
+	bool enable_pipelining{ true };
 
 	// Maximum number of un-responded requests per channel, should be lower or equal to bootstrap server max queue size
+	// Each channel's window adapts to its reply latency up to this limit
 	std::size_t channel_limit{ 16 };
 	std::size_t database_rate_limit{ 256 };
 	std::size_t frontier_rate_limit{ 100 };
@@ -60,6 +62,8 @@ public:
 	std::chrono::milliseconds throttle_wait{ 100 };
 	std::size_t block_processor_threshold{ 1000 };
 	std::size_t max_requests{ 1024 };
+	// Maximum number of received blocks held back while the block processor is saturated
+	std::size_t max_staged_blocks{ 16 * 1024 };
 
 	account_sets_config account_sets;
 	frontier_scan_config frontier_scan;
@@ -222,7 +222,10 @@ void nano::bootstrap_server::run_batch (nano::unique_lock<nano::mutex> & lock)
 
 		if (!channel->max (nano::transport::traffic_type::bootstrap))
 		{
+			auto const start = std::chrono::steady_clock::now ();
 			auto response = process (transaction, request);
+			stats.sample (to_stat_sample (request.type), nano::log::microseconds (std::chrono::steady_clock::now () - start), { 0, 1000 * 100 /* 0-100 milliseconds range */ });
+
 			respond (response, channel);
 		}
 		else
@@ -255,13 +258,28 @@ nano::asc_pull_ack nano::bootstrap_server::process (secure::transaction const &
 {
 	const std::size_t count = std::min (static_cast<std::size_t> (request.count), max_blocks);
 
+	cache_key const key{ request.start, request.start_type, static_cast<uint8_t> (count) };
+	if (auto cached = cache_get (transaction, key))
+	{
+		stats.inc (nano::stat::type::bootstrap_server, nano::stat::detail::cache_hit);
+		return prepare_response (id, std::move (*cached));
+	}
+	stats.inc (nano::stat::type::bootstrap_server, nano::stat::detail::cache_miss);
+
+	auto respond_with = [&] (nano::block_hash const & start_block) {
+		auto blocks = prepare_blocks (transaction, start_block, count);
+		debug_assert (blocks.size () <= count);
+		cache_put (key, blocks);
+		return prepare_response (id, std::move (blocks));
+	};
+
 	switch (request.start_type)
 	{
 		case asc_pull_req::hash_type::block:
 		{
 			if (ledger.any.block_exists (transaction, request.start.as_block_hash ()))
 			{
-				return prepare_response (transaction, id, request.start.as_block_hash (), count);
+				return respond_with (request.start.as_block_hash ());
 			}
 		}
 		break;
@@ -271,7 +289,7 @@ nano::asc_pull_ack nano::bootstrap_server::process (secure::transaction const &
 			if (info)
 			{
 				// Start from open block if pulling by account
-				return prepare_response (transaction, id, info->open_block, count);
+				return respond_with (info->open_block);
 			}
 		}
 		break;
@@ -281,20 +299,17 @@ nano::asc_pull_ack nano::bootstrap_server::process (secure::transaction const &
 	return prepare_empty_blocks_response (id);
 }
 
-nano::asc_pull_ack nano::bootstrap_server::prepare_response (secure::transaction const & transaction, nano::asc_pull_req::id_t id, nano::block_hash start_block, std::size_t count) const
+nano::asc_pull_ack nano::bootstrap_server::prepare_response (nano::asc_pull_req::id_t id, std::deque<std::shared_ptr<nano::block>> blocks) const
 {
-	debug_assert (count <= max_blocks); // Should be filtered out earlier
-
-	auto blocks = prepare_blocks (transaction, start_block, count);
-	debug_assert (blocks.size () <= count);
+	debug_assert (blocks.size () <= max_blocks); // Should be filtered out earlier
 
 	nano::asc_pull_ack response{ network_constants };
 	response.id = id;
 	response.type = nano::asc_pull_type::blocks;
 
 	nano::asc_pull_ack::blocks_payload response_payload{};
-	response_payload.blocks = blocks;
-	response.payload = response_payload;
+	response_payload.blocks = std::move (blocks);
+	response.payload = std::move (response_payload);
 
 	response.update_header ();
 	return response;
@@ -332,6 +347,113 @@ std::deque<std::shared_ptr<nano::block>> nano::bootstrap_server::prepare_blocks
 	return result;
 }
 
+/*
+ * Blocks response cache
+ */
+
+size_t nano::bootstrap_server::cache_key_hash::operator() (cache_key const & key) const
+{
+	return std::hash<nano::hash_or_account>{}(key.start) ^ (static_cast<size_t> (key.start_type) << 8) ^ key.count;
+}
+
+auto nano::bootstrap_server::cache_get (secure::transaction const & transaction, cache_key const & key) const -> std::optional<std::deque<std::shared_ptr<nano::block>>>
+{
+	std::deque<std::shared_ptr<nano::block>> blocks;
+	{
+		nano::lock_guard<nano::mutex> guard{ cache_mutex };
+
+		auto & index = cache.get<tag_key> ();
+		auto existing = index.find (key);
+		if (existing == index.end ())
+		{
+			return std::nullopt;
+		}
+		blocks = existing->blocks;
+		// Move to the front as the most recently used entry
+		cache.relocate (cache.begin (), cache.project<tag_sequenced> (existing));
+	}
+
+	// Validating reads from the ledger, so it is done without holding the cache lock
+	if (!cache_valid (transaction, { key, blocks }))
+	{
+		stats.inc (nano::stat::type::bootstrap_server, nano::stat::detail::cache_stale);
+
+		nano::lock_guard<nano::mutex> guard{ cache_mutex };
+		auto & index = cache.get<tag_key> ();
+		// The entry may have been replaced with fresh blocks in the meantime
+		if (auto existing = index.find (key); existing != index.end () && existing->blocks == blocks)
+		{
+			index.erase (existing);
+		}
+		return std::nullopt;
+	}
+	return blocks;
+}
+
+void nano::bootstrap_server::cache_put (cache_key const & key, std::deque<std::shared_ptr<nano::block>> const & blocks) const
+{
+	// Empty responses are cheap to produce and would need extra lookups to validate
+	if (blocks.empty () || config.cache_size == 0)
+	{
+		return;
+	}
+
+	nano::lock_guard<nano::mutex> guard{ cache_mutex };
+
+	auto & index = cache.get<tag_key> ();
+	if (auto existing = index.find (key); existing != index.end ())
+	{
+		index.erase (existing);
+	}
+	cache.push_front ({ key, blocks });
+	while (cache.size () > config.cache_size)
+	{
+		cache.pop_back ();
+	}
+}
+
+bool nano::bootstrap_server::cache_valid (secure::transaction const & transaction, cache_entry const & entry) const
+{
+	debug_assert (!entry.blocks.empty ());
+
+	auto const & front = entry.blocks.front ();
+	auto const & back = entry.blocks.back ();
+
+	// Pulling by account starts from the open block, which changes if the account was rolled back and reopened
+	if (entry.key.start_type == nano::asc_pull_req::hash_type::account)
+	{
+		auto info = ledger.any.account_get (transaction, entry.key.start.as_account ());
+		if (!info || info->open_block != front->hash ())
+		{
+			return false;
+		}
+	}
+
+	// Blocks can only be rolled back from the top of the chain, so if the last block still exists all previous ones do as well
+	if (!ledger.any.block_exists (transaction, back->hash ()))
+	{
+		return false;
+	}
+
+	// A partial response is only valid as long as the chain was not extended past the last block
+	if (entry.blocks.size () < entry.key.count)
+	{
+		return !ledger.any.block_successor (transaction, back->hash ()).has_value ();
+	}
+	return true;
+}
+
+std::unique_ptr<nano::container_info_component> nano::bootstrap_server::collect_container_info (std::string const & name) const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	nano::lock_guard<nano::mutex> cache_guard{ cache_mutex };
+
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (queue.collect_container_info ("queue"));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "cache", cache.size (), sizeof (decltype (cache)::value_type) }));
+	return composite;
+}
+
 /*
  * Account info request
  */
@@ -424,6 +546,22 @@ nano::stat::detail nano::to_stat_detail (nano::asc_pull_type type)
 	}
 }
 
+nano::stat::sample nano::to_stat_sample (nano::asc_pull_type type)
+{
+	switch (type)
+	{
+		case asc_pull_type::blocks:
+			return nano::stat::sample::bootstrap_server_blocks_time;
+		case asc_pull_type::account_info:
+			return nano::stat::sample::bootstrap_server_account_info_time;
+		case asc_pull_type::frontiers:
+			return nano::stat::sample::bootstrap_server_frontiers_time;
+		default:
+			debug_assert (false);
+			return nano::stat::sample::_invalid;
+	}
+}
+
 /*
  * bootstrap_server_config
  */
@@ -433,6 +571,7 @@ nano::error nano::bootstrap_server_config::serialize (nano::tomlconfig & toml) c
 	toml.put ("max_queue", max_queue, "Maximum number of queued requests per peer. \ntype:uint64");
 	toml.put ("threads", threads, "Number of threads to process requests. \ntype:uint64");
 	toml.put ("batch_size", batch_size, "Maximum number of requests to process in a single batch. \ntype:uint64");
+	toml.put ("cache_size", cache_size, "Maximum number of recently served blocks responses to keep in memory. Cached responses are validated against the ledger before reuse. 0 disables the cache. \ntype:uint64");
 
 	return toml.get_error ();
 }
@@ -442,6 +581,7 @@ nano::error nano::bootstrap_server_config::deserialize (nano::tomlconfig & toml)
 	toml.get ("max_queue", max_queue);
 	toml.get ("threads", threads);
 	toml.get ("batch_size", batch_size);
+	toml.get ("cache_size", cache_size);
 
 	return toml.get_error ();
 }
@@ -2,16 +2,24 @@
 
 #include <nano/lib/locks.hpp>
 #include <nano/lib/observer_set.hpp>
+#include <nano/lib/threading.hpp>
 #include <nano/node/fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/node/messages.hpp>
 
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
 #include <atomic>
 #include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
 
+namespace mi = boost::multi_index;
+
 namespace nano
 {
 class bootstrap_server_config final
@@ -22,8 +30,9 @@ public:
 
 public:
 	size_t max_queue{ 16 };
-	size_t threads{ 1 };
+	size_t threads{ std::clamp (nano::hardware_concurrency () / 4, 1u, 4u) };
 	size_t batch_size{ 64 };
+	size_t cache_size{ 1024 * 4 };
 };
 
 /**
@@ -44,6 +53,8 @@ public:
 	 */
 	bool request (nano::asc_pull_req const & message, std::shared_ptr<nano::transport::channel> channel);
 
+	std::unique_ptr<container_info_component> collect_container_info (std::string const & name) const;
+
 public: // Events
 	nano::observer_set<nano::asc_pull_ack const &, std::shared_ptr<nano::transport::channel> const &> on_response;
 
@@ -62,10 +73,38 @@ private:
 	 * Blocks request
 	 */
 	nano::asc_pull_ack process (secure::transaction const &, nano::asc_pull_req::id_t id, nano::asc_pull_req::blocks_payload const & request) const;
-	nano::asc_pull_ack prepare_response (secure::transaction const &, nano::asc_pull_req::id_t id, nano::block_hash start_block, std::size_t count) const;
+	nano::asc_pull_ack prepare_response (nano::asc_pull_req::id_t id, std::deque<std::shared_ptr<nano::block>> blocks) const;
 	nano::asc_pull_ack prepare_empty_blocks_response (nano::asc_pull_req::id_t id) const;
 	std::deque<std::shared_ptr<nano::block>> prepare_blocks (secure::transaction const &, nano::block_hash start_block, std::size_t count) const;
 
+	/*
+	 * Blocks response cache
+	 */
+	struct cache_key
+	{
+		nano::hash_or_account start;
+		nano::asc_pull_req::hash_type start_type;
+		uint8_t count;
+
+		bool operator== (cache_key const &) const = default;
+	};
+
+	struct cache_key_hash
+	{
+		size_t operator() (cache_key const &) const;
+	};
+
+	struct cache_entry
+	{
+		cache_key key;
+		std::deque<std::shared_ptr<nano::block>> blocks;
+	};
+
+	std::optional<std::deque<std::shared_ptr<nano::block>>> cache_get (secure::transaction const &, cache_key const &) const;
+	void cache_put (cache_key const &, std::deque<std::shared_ptr<nano::block>> const &) const;
+	/** Checks that cached blocks still match the ledger, which only takes a couple of lookups instead of reading the whole chain again */
+	bool cache_valid (secure::transaction const &, cache_entry const &) const;
+
 	/*
 	 * Account info request
 	 */
@@ -92,6 +131,22 @@ private: // Dependencies
 private:
 	nano::fair_queue<request_t, nano::no_value> queue;
 
+	// clang-format off
+	class tag_sequenced {};
+	class tag_key {};
+
+	using ordered_cache = boost::multi_index_container<cache_entry,
+	mi::indexed_by<
+		mi::sequenced<mi::tag<tag_sequenced>>,
+		mi::hashed_unique<mi::tag<tag_key>,
+			mi::member<cache_entry, cache_key, &cache_entry::key>, cache_key_hash>
+	>>;
+	// clang-format on
+
+	// Most recently used entries are at the front
+	mutable ordered_cache cache;
+	mutable nano::mutex cache_mutex;
+
 	std::atomic<bool> stopped{ false };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex;
@@ -104,4 +159,5 @@ public: // Config
 };
 
 nano::stat::detail to_stat_detail (nano::asc_pull_type);
+nano::stat::sample to_stat_sample (nano::asc_pull_type);
 }
@@ -1,28 +1,38 @@
+#include <nano/lib/stats.hpp>
 #include <nano/node/bootstrap/bootstrap_config.hpp>
 #include <nano/node/bootstrap_ascending/peer_scoring.hpp>
 #include <nano/node/transport/channel.hpp>
 
+#include <limits>
+
 /*
  * peer_scoring
  */
 
-nano::bootstrap_ascending::peer_scoring::peer_scoring (bootstrap_ascending_config const & config_a, nano::network_constants const & network_constants_a) :
+nano::bootstrap_ascending::peer_scoring::peer_scoring (bootstrap_ascending_config const & config_a, nano::network_constants const & network_constants_a, nano::stats & stats_a) :
 	config{ config_a },
-	network_constants{ network_constants_a }
+	network_constants{ network_constants_a },
+	stats{ stats_a }
 {
 }
 
+double nano::bootstrap_ascending::peer_scoring::max_window () const
+{
+	// Zero disables the limit
+	return config.channel_limit > 0 ? static_cast<double> (config.channel_limit) : std::numeric_limits<double>::max ();
+}
+
 bool nano::bootstrap_ascending::peer_scoring::try_send_message (std::shared_ptr<nano::transport::channel> channel)
 {
 	auto & index = scoring.get<tag_channel> ();
 	auto existing = index.find (channel.get ());
 	if (existing == index.end ())
 	{
-		index.emplace (channel, 1, 1, 0);
+		index.emplace (channel, 1, std::min (initial_window, max_window ()));
 	}
 	else
 	{
-		if (existing->outstanding < config.channel_limit)
+		if (existing->outstanding < existing->window)
 		{
 			[[maybe_unused]] auto success = index.modify (existing, [] (auto & score) {
 				++score.outstanding;
@@ -38,28 +48,64 @@ bool nano::bootstrap_ascending::peer_scoring::try_send_message (std::shared_ptr<
 	return false;
 }
 
-void nano::bootstrap_ascending::peer_scoring::received_message (std::shared_ptr<nano::transport::channel> channel)
+void nano::bootstrap_ascending::peer_scoring::received_message (std::shared_ptr<nano::transport::channel> channel, std::chrono::milliseconds rtt, std::size_t count)
 {
 	auto & index = scoring.get<tag_channel> ();
 	auto existing = index.find (channel.get ());
 	if (existing != index.end ())
 	{
-		if (existing->outstanding > 1)
-		{
-			[[maybe_unused]] auto success = index.modify (existing, [] (auto & score) {
-				--score.outstanding;
-				++score.response_count_total;
-			});
-			debug_assert (success);
-		}
+		bool increased = false;
+		[[maybe_unused]] auto success = index.modify (existing, [this, rtt, count, &increased] (auto & score) {
+			score.outstanding = score.outstanding > 0 ? score.outstanding - 1 : 0;
+			++score.response_count_total;
+			score.blocks += count;
+
+			auto const sample = std::max (1.0, static_cast<double> (rtt.count ()));
+			score.rtt_min = score.rtt_min > 0 ? std::min (score.rtt_min, sample) : sample;
+			score.rtt = score.rtt > 0 ? score.rtt + (sample - score.rtt) / 8 : sample;
+
+			if (sample <= score.rtt_min * latency_tolerance)
+			{
+				score.window += score.window < score.threshold ? 1.0 : 1.0 / score.window;
+				increased = true;
+			}
+			else
+			{
+				score.window -= 1.0 / score.window;
+			}
+			score.window = std::clamp (score.window, min_window, max_window ());
+		});
+		debug_assert (success);
+		stats.inc (nano::stat::type::bootstrap_ascending_peers, increased ? nano::stat::detail::window_increase : nano::stat::detail::window_decrease);
+	}
+}
+
+void nano::bootstrap_ascending::peer_scoring::timeout_message (std::shared_ptr<nano::transport::channel> channel)
+{
+	auto & index = scoring.get<tag_channel> ();
+	auto existing = index.find (channel.get ());
+	if (existing != index.end ())
+	{
+		[[maybe_unused]] auto success = index.modify (existing, [] (auto & score) {
+			score.outstanding = score.outstanding > 0 ? score.outstanding - 1 : 0;
+			++score.timeout_count_total;
+			score.threshold = std::max (min_window, score.window / 2);
+			score.window = score.threshold;
+		});
+		debug_assert (success);
+		stats.inc (nano::stat::type::bootstrap_ascending_peers, nano::stat::detail::timeout);
 	}
 }
 
 std::shared_ptr<nano::transport::channel> nano::bootstrap_ascending::peer_scoring::channel ()
 {
-	auto & index = scoring.get<tag_outstanding> ();
+	auto & index = scoring.get<tag_utilization> ();
 	for (auto const & score : index)
 	{
+		if (score.utilization () >= 1.0)
+		{
+			break; // Remaining peers have full windows
+		}
 		if (auto channel = score.shared ())
 		{
 			if (!channel->max ())
@@ -94,10 +140,17 @@ void nano::bootstrap_ascending::peer_scoring::timeout ()
 		return true;
 	});
 
+	auto const now = std::chrono::steady_clock::now ();
+	auto const elapsed = std::max (std::chrono::duration<double> (now - last_timeout).count (), 1e-3);
+	last_timeout = now;
+
 	for (auto score = scoring.begin (), n = scoring.end (); score != n; ++score)
 	{
-		scoring.modify (score, [] (auto & score_a) {
-			score_a.decay ();
+		scoring.modify (score, [elapsed] (auto & score_a) {
+			score_a.throughput = (score_a.throughput + score_a.blocks / elapsed) / 2;
+			score_a.blocks = 0;
+			// Let the minimum drift towards the smoothed latency so a permanent route change does not leave the peer looking congested
+			score_a.rtt_min += (score_a.rtt - score_a.rtt_min) / 4;
 		});
 	}
 }
@@ -113,23 +166,50 @@ void nano::bootstrap_ascending::peer_scoring::sync (std::deque<std::shared_ptr<n
 			{
 				if (!channel->max (nano::transport::traffic_type::bootstrap))
 				{
-					index.emplace (channel, 1, 1, 0);
+					index.emplace (channel, 0, std::min (initial_window, max_window ()));
 				}
 			}
 		}
 	}
 }
 
+auto nano::bootstrap_ascending::peer_scoring::peers () const -> std::vector<peer_info>
+{
+	std::vector<peer_info> result;
+	result.reserve (scoring.size ());
+	for (auto const & score : scoring)
+	{
+		result.push_back ({ score.shared (), score.outstanding, score.window, std::chrono::milliseconds{ static_cast<int64_t> (score.rtt) }, score.throughput, score.request_count_total, score.response_count_total, score.timeout_count_total });
+	}
+	return result;
+}
+
+std::unique_ptr<nano::container_info_component> nano::bootstrap_ascending::peer_scoring::collect_container_info (std::string const & name) const
+{
+	uint64_t outstanding = 0;
+	double window = 0;
+	for (auto const & score : scoring)
+	{
+		outstanding += score.outstanding;
+		window += score.window;
+	}
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "peers", scoring.size (), sizeof (decltype (scoring)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "outstanding", outstanding, 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "window", static_cast<std::size_t> (window), 0 }));
+	return composite;
+}
+
 /*
  * peer_score
  */
 
-nano::bootstrap_ascending::peer_scoring::peer_score::peer_score (
-std::shared_ptr<nano::transport::channel> const & channel_a, uint64_t outstanding_a, uint64_t request_count_total_a, uint64_t response_count_total_a) :
+nano::bootstrap_ascending::peer_scoring::peer_score::peer_score (std::shared_ptr<nano::transport::channel> const & channel_a, uint64_t outstanding_a, double window_a) :
 	channel{ channel_a },
 	channel_ptr{ channel_a.get () },
 	outstanding{ outstanding_a },
-	request_count_total{ request_count_total_a },
-	response_count_total{ response_count_total_a }
+	request_count_total{ outstanding_a },
+	window{ window_a },
+	threshold{ std::numeric_limits<double>::max () }
 {
 }
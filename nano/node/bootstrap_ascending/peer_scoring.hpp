@@ -1,50 +1,88 @@
 #pragma once
 
 #include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <chrono>
 #include <deque>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace mi = boost::multi_index;
 
 namespace nano
 {
 class bootstrap_ascending_config;
+class container_info_component;
 class network_constants;
+class stats;
 namespace transport
 {
 	class channel;
 }
 namespace bootstrap_ascending
 {
-	// Container for tracking and scoring peers with respect to bootstrapping
+	/**
+	 * Container for tracking and scoring peers with respect to bootstrapping
+	 * Each peer has a window of allowed outstanding requests which is sized from measured reply latency, similar to congestion control:
+	 * the window grows while replies arrive close to the lowest observed round trip time, shrinks slowly when latency builds up and is halved on timeouts.
+	 * Requests are routed to the peer with the lowest window utilization, so fast peers receive proportionally more requests.
+	 */
 	class peer_scoring
 	{
 	public:
-		peer_scoring (bootstrap_ascending_config const &, nano::network_constants const &);
+		peer_scoring (bootstrap_ascending_config const &, nano::network_constants const &, nano::stats &);
 
 		// Returns true if channel limit has been exceeded
 		bool try_send_message (std::shared_ptr<nano::transport::channel> channel);
-		void received_message (std::shared_ptr<nano::transport::channel> channel);
+		// Updates latency, throughput and window estimates with a reply to a request sent `rtt` ago, carrying `count` blocks
+		void received_message (std::shared_ptr<nano::transport::channel> channel, std::chrono::milliseconds rtt, std::size_t count);
+		// Shrinks the window of a peer which did not reply in time
+		void timeout_message (std::shared_ptr<nano::transport::channel> channel);
 		std::shared_ptr<nano::transport::channel> channel ();
 		[[nodiscard]] std::size_t size () const;
-		// Cleans up scores for closed channels
-		// Decays scores which become inaccurate over time due to message drops
+		// Cleans up scores for closed channels and updates throughput estimates
 		void timeout ();
 		void sync (std::deque<std::shared_ptr<nano::transport::channel>> const & list);
 
+		struct peer_info
+		{
+			std::shared_ptr<nano::transport::channel> channel;
+			uint64_t outstanding;
+			double window;
+			std::chrono::milliseconds rtt;
+			double throughput; // Blocks per second
+			uint64_t request_count_total;
+			uint64_t response_count_total;
+			uint64_t timeout_count_total;
+		};
+		std::vector<peer_info> peers () const;
+
+		std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name) const;
+
+	public: // Window sizing
+		static double constexpr initial_window{ 4.0 };
+		static double constexpr min_window{ 1.0 };
+		// Replies slower than this multiple of the lowest observed round trip time count as congestion
+		static double constexpr latency_tolerance{ 2.0 };
+
+	private:
+		double max_window () const;
+
 	private:
 		bootstrap_ascending_config const & config;
 		nano::network_constants const & network_constants;
+		nano::stats & stats;
 
 	private:
 		class peer_score
 		{
 		public:
-			explicit peer_score (std::shared_ptr<nano::transport::channel> const &, uint64_t, uint64_t, uint64_t);
+			peer_score (std::shared_ptr<nano::transport::channel> const &, uint64_t outstanding, double window);
 			std::weak_ptr<nano::transport::channel> channel;
 			// std::weak_ptr does not provide ordering so the naked pointer is also tracked and used for ordering channels
 			// This pointer may be invalid if the channel has been destroyed
@@ -59,30 +97,40 @@ namespace bootstrap_ascending
 				}
 				return result;
 			}
-			void decay ()
+			// Fraction of the window currently in use
+			double utilization () const
 			{
-				outstanding = outstanding > 0 ? outstanding - 1 : 0;
+				return static_cast<double> (outstanding) / window;
 			}
 			// Number of outstanding requests to a peer
 			uint64_t outstanding{ 0 };
 			uint64_t request_count_total{ 0 };
 			uint64_t response_count_total{ 0 };
+			uint64_t timeout_count_total{ 0 };
+
+			double window;
+			double threshold; // Window size up to which the window grows by one per reply instead of one per window
+			double rtt{ 0 }; // Smoothed round trip time in milliseconds
+			double rtt_min{ 0 };
+			double throughput{ 0 };
+			uint64_t blocks{ 0 }; // Blocks received since the last throughput update
 		};
 
 		// clang-format off
 		// Indexes scores by their shared channel pointer
 		class tag_channel {};
-		// Indexes scores by the number of outstanding requests in ascending order
-		class tag_outstanding {};
+		// Indexes scores by the fraction of their window in use, in ascending order
+		class tag_utilization {};
 
 		using scoring_t = boost::multi_index_container<peer_score,
 		mi::indexed_by<
 			mi::hashed_unique<mi::tag<tag_channel>,
 				mi::member<peer_score, nano::transport::channel *, &peer_score::channel_ptr>>,
-			mi::ordered_non_unique<mi::tag<tag_outstanding>,
-				mi::member<peer_score, uint64_t, &peer_score::outstanding>>>>;
+			mi::ordered_non_unique<mi::tag<tag_utilization>,
+				mi::const_mem_fun<peer_score, double, &peer_score::utilization>>>>;
 		// clang-format on
 		scoring_t scoring;
+		std::chrono::steady_clock::time_point last_timeout{ std::chrono::steady_clock::now () };
 	};
 }
 }
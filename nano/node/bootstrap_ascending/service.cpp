@@ -33,7 +33,7 @@ nano::bootstrap_ascending::service::service (nano::node_config const & node_conf
 	database_scan{ ledger },
 	frontiers{ config.frontier_scan, stats },
 	throttle{ compute_throttle_size () },
-	scoring{ config, node_config_a.network_params.network },
+	scoring{ config, node_config_a.network_params.network, stats },
 	database_limiter{ config.database_rate_limit },
 	frontiers_limiter{ config.frontier_rate_limit },
 	workers{ 1, nano::thread_role::name::ascending_bootstrap_worker }
@@ -138,6 +138,7 @@ bool nano::bootstrap_ascending::service::send (std::shared_ptr<nano::transport::
 	debug_assert (tag.type != query_type::invalid);
 	debug_assert (tag.source != query_source::invalid);
 
+	tag.channel = channel;
 	{
 		nano::lock_guard<nano::mutex> lock{ mutex };
 		debug_assert (tags.get<tag_id> ().count (tag.id) == 0);
@@ -218,6 +219,12 @@ std::size_t nano::bootstrap_ascending::service::score_size () const
 	return scoring.size ();
 }
 
+std::size_t nano::bootstrap_ascending::service::staged_size () const
+{
+	nano::lock_guard<nano::mutex> lock{ staging_mutex };
+	return staged_blocks;
+}
+
 bool nano::bootstrap_ascending::service::prioritized (nano::account const & account) const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
@@ -544,6 +551,10 @@ void nano::bootstrap_ascending::service::run_one_priority ()
 {
 	wait_tags ();
 	wait_blockprocessor ();
+	if (flush_staged ())
+	{
+		return; // Staged blocks take precedence over new requests
+	}
 	auto channel = wait_channel ();
 	if (!channel)
 	{
@@ -687,10 +698,17 @@ void nano::bootstrap_ascending::service::cleanup_and_sync ()
 	{
 		auto tag = tags_by_order.front ();
 		tags_by_order.pop_front ();
+		if (auto channel = tag.channel.lock ())
+		{
+			scoring.timeout_message (channel);
+		}
 		on_timeout.notify (tag);
 		stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::timeout);
 	}
 
+	// Fallback for when the priority thread, which normally flushes staged blocks, is disabled
+	flush_staged ();
+
 	if (sync_dependencies_interval.elapsed (60s))
 	{
 		stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::sync_dependencies);
@@ -760,7 +778,9 @@ void nano::bootstrap_ascending::service::process (nano::asc_pull_ack const & mes
 	stats.inc (nano::stat::type::bootstrap_ascending_reply, to_stat_detail (tag.type));
 	stats.sample (nano::stat::sample::bootstrap_tag_duration, nano::log::milliseconds_delta (tag.timestamp), { 0, config.request_timeout.count () });
 
-	scoring.received_message (channel);
+	auto const rtt = std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - tag.timestamp);
+	auto const blocks = std::holds_alternative<nano::asc_pull_ack::blocks_payload> (message.payload) ? std::get<nano::asc_pull_ack::blocks_payload> (message.payload).blocks.size () : 0;
+	scoring.received_message (channel, rtt, blocks);
 
 	lock.unlock ();
 
@@ -795,24 +815,16 @@ void nano::bootstrap_ascending::service::process (const nano::asc_pull_ack::bloc
 				blocks.pop_front ();
 			}
 
-			for (auto const & block : blocks)
+			// A full page indicates there are likely more blocks to follow, request them without waiting for this page to be processed
+			bool const full_page = response.blocks.size () == tag.count;
+			auto const last = blocks.empty () ? nano::block_hash{ 0 } : blocks.back ()->hash ();
+
+			bool const accepted = submit (tag.account, std::move (blocks));
+
+			// A dropped page will never be processed, so there is nothing to continue from
+			if (config.enable_pipelining && accepted && full_page && !last.is_zero () && (tag.source == query_source::priority || tag.source == query_source::pipeline))
 			{
-				if (block == blocks.back ())
-				{
-					// It's the last block submitted for this account chain, reset timestamp to allow more requests
-					block_processor.add (block, nano::block_source::bootstrap, nullptr, [this, account = tag.account] (auto result) {
-						stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::timestamp_reset);
-						{
-							nano::lock_guard<nano::mutex> guard{ mutex };
-							accounts.timestamp_reset (account);
-						}
-						condition.notify_all ();
-					});
-				}
-				else
-				{
-					block_processor.add (block, nano::block_source::bootstrap);
-				}
+				pipeline (tag, last);
 			}
 
 			if (tag.source == query_source::database)
@@ -1001,6 +1013,117 @@ void nano::bootstrap_ascending::service::process_frontiers (std::deque<std::pair
 	}
 }
 
+bool nano::bootstrap_ascending::service::submit (nano::account const & account, std::deque<std::shared_ptr<nano::block>> blocks)
+{
+	if (blocks.empty ())
+	{
+		return true;
+	}
+
+	nano::unique_lock<nano::mutex> lock{ staging_mutex };
+
+	// Pages must reach block processor in the order they were received, so once anything is staged everything goes through staging
+	if (staged.empty () && block_processor.size (nano::block_source::bootstrap) < config.block_processor_threshold)
+	{
+		lock.unlock ();
+		add_blocks (account, blocks);
+		return true;
+	}
+
+	if (staged_blocks + blocks.size () > config.max_staged_blocks)
+	{
+		// Dropped blocks will be requested again once the account is prioritized
+		stats.add (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged_dropped, blocks.size ());
+		return false;
+	}
+
+	stats.add (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged, blocks.size ());
+	staged_blocks += blocks.size ();
+	staged.emplace_back (account, std::move (blocks));
+	return true;
+}
+
+void nano::bootstrap_ascending::service::add_blocks (nano::account const & account, std::deque<std::shared_ptr<nano::block>> const & blocks)
+{
+	for (auto const & block : blocks)
+	{
+		if (block == blocks.back ())
+		{
+			// It's the last block submitted for this account chain, reset timestamp to allow more requests
+			block_processor.add (block, nano::block_source::bootstrap, nullptr, [this, account] (auto result) {
+				{
+					nano::lock_guard<nano::mutex> guard{ mutex };
+					// Pipelined requests are already fetching the rest of this chain
+					if (count_tags (account, query_source::pipeline) == 0)
+					{
+						stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::timestamp_reset);
+						accounts.timestamp_reset (account);
+					}
+				}
+				condition.notify_all ();
+			});
+		}
+		else
+		{
+			block_processor.add (block, nano::block_source::bootstrap);
+		}
+	}
+}
+
+bool nano::bootstrap_ascending::service::flush_staged ()
+{
+	nano::unique_lock<nano::mutex> lock{ staging_mutex };
+	while (!staged.empty () && block_processor.size (nano::block_source::bootstrap) < config.block_processor_threshold)
+	{
+		auto [account, blocks] = std::move (staged.front ());
+		staged.pop_front ();
+		staged_blocks -= blocks.size ();
+		// Staging lock is held while adding so that concurrent flushes keep pages in order
+		add_blocks (account, blocks);
+		stats.add (nano::stat::type::bootstrap_ascending, nano::stat::detail::staged_flushed, blocks.size ());
+	}
+	return !staged.empty ();
+}
+
+void nano::bootstrap_ascending::service::pipeline (async_tag const & previous, nano::block_hash const & last)
+{
+	{
+		nano::lock_guard<nano::mutex> lock{ staging_mutex };
+		// Leave room in the staging buffer for pages that are already in flight
+		if (staged_blocks >= config.max_staged_blocks / 2)
+		{
+			return;
+		}
+	}
+
+	std::shared_ptr<nano::transport::channel> channel;
+	{
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		if (tags.size () >= config.max_requests)
+		{
+			return;
+		}
+		channel = scoring.channel ();
+		if (!channel)
+		{
+			return;
+		}
+		// Keep the account in cool down so priority requests do not duplicate the pipelined one
+		accounts.timestamp_set (previous.account);
+	}
+
+	async_tag tag{};
+	tag.type = query_type::blocks_by_hash;
+	tag.source = query_source::pipeline;
+	tag.account = previous.account;
+	tag.start = last;
+	tag.hash = last;
+	tag.count = config.max_pull_count;
+
+	stats.inc (nano::stat::type::bootstrap_ascending, nano::stat::detail::pipeline);
+	send (channel, tag);
+}
+
 nano::bootstrap_ascending::service::verify_result nano::bootstrap_ascending::service::verify (const nano::asc_pull_ack::blocks_payload & response, const nano::bootstrap_ascending::service::async_tag & tag) const
 {
 	auto const & blocks = response.blocks;
@@ -1111,9 +1234,11 @@ std::unique_ptr<nano::container_info_component> nano::bootstrap_ascending::servi
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "tags", tags.size (), sizeof (decltype (tags)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "throttle", throttle.size (), 0 }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "throttle_successes", throttle.successes (), 0 }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "staged", staged_size (), sizeof (std::shared_ptr<nano::block>) }));
 	composite->add_component (accounts.collect_container_info ("accounts"));
 	composite->add_component (database_scan.collect_container_info ("database_scan"));
 	composite->add_component (frontiers.collect_container_info ("frontiers"));
+	composite->add_component (scoring.collect_container_info ("scoring"));
 	composite->add_component (workers.collect_container_info ("workers"));
 	return composite;
 }
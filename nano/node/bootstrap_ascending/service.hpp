@@ -26,6 +26,8 @@ namespace mi = boost::multi_index;
 
 namespace nano
 {
+class bootstrap_ascending_staging_Test;
+
 namespace bootstrap_ascending
 {
 	class service
@@ -47,6 +49,7 @@ namespace bootstrap_ascending
 		std::size_t blocked_size () const;
 		std::size_t priority_size () const;
 		std::size_t score_size () const;
+		std::size_t staged_size () const;
 		bool prioritized (nano::account const &) const;
 		bool blocked (nano::account const &) const;
 		nano::bootstrap_ascending::account_sets::info_t info () const;
@@ -77,6 +80,7 @@ namespace bootstrap_ascending
 			database,
 			blocking,
 			frontiers,
+			pipeline, // Next page of a long chain, requested before the previous page is processed
 		};
 
 		struct async_tag
@@ -90,6 +94,7 @@ namespace bootstrap_ascending
 
 			id_t id{ generate_id () };
 			std::chrono::steady_clock::time_point timestamp{ std::chrono::steady_clock::now () };
+			std::weak_ptr<nano::transport::channel> channel; // Channel the request was sent to
 		};
 
 	public: // Events
@@ -145,6 +150,14 @@ namespace bootstrap_ascending
 
 		void process_frontiers (std::deque<std::pair<nano::account, nano::block_hash>> const & frontiers);
 
+		/* Queues verified blocks for processing, holding them back in the staging buffer while block processor is saturated. Returns false if the page was dropped */
+		bool submit (nano::account const &, std::deque<std::shared_ptr<nano::block>> blocks);
+		void add_blocks (nano::account const &, std::deque<std::shared_ptr<nano::block>> const & blocks);
+		/* Moves staged blocks to block processor as long as there is space. Returns true if blocks remain staged */
+		bool flush_staged ();
+		/* Requests the next page of an account chain which returned a full page */
+		void pipeline (async_tag const & tag, nano::block_hash const & last);
+
 		enum class verify_result
 		{
 			ok,
@@ -200,6 +213,11 @@ namespace bootstrap_ascending
 
 		nano::interval sync_dependencies_interval;
 
+		// Pages of blocks received while block processor was above its threshold, in arrival order
+		std::deque<std::pair<nano::account, std::deque<std::shared_ptr<nano::block>>>> staged;
+		std::size_t staged_blocks{ 0 };
+		mutable nano::mutex staging_mutex;
+
 		bool stopped{ false };
 		mutable nano::mutex mutex;
 		mutable nano::condition_variable condition;
@@ -210,6 +228,8 @@ namespace bootstrap_ascending
 		std::thread timeout_thread;
 
 		nano::thread_pool workers;
+
+		friend class nano::bootstrap_ascending_staging_Test;
 	};
 
 	nano::stat::detail to_stat_detail (service::query_type);
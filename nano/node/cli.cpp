@@ -5,8 +5,13 @@
 #include <nano/node/common.hpp>
 #include <nano/node/daemonconfig.hpp>
 #include <nano/node/inactive_node.hpp>
+#include <nano/node/make_store.hpp>
 #include <nano/node/node.hpp>
 #include <nano/secure/ledger.hpp>
+#include <nano/store/account.hpp>
+#include <nano/store/counters.hpp>
+#include <nano/store/snapshot.hpp>
+#include <nano/store/unconfirmed.hpp>
 
 #include <boost/format.hpp>
 
@@ -59,6 +64,8 @@ void nano::add_node_options (boost::program_options::options_description & descr
 	("final_vote_clear", "Clear final votes")
 	("rebuild_database", "Rebuild LMDB database with vacuum for best compaction")
 	("migrate_database_lmdb_to_rocksdb", "Migrates LMDB database to RocksDB")
+	("ledger_snapshot_export", "Writes a consistent copy of the ledger to <file>, which can be loaded into a new node with --ledger_snapshot_import")
+	("ledger_snapshot_import", "Loads a ledger snapshot from <file> into an empty database")
 	("diagnostics", "Run internal diagnostics")
 	("generate_config", boost::program_options::value<std::string> (), "Write configuration to stdout, populated with defaults suitable for this system. Pass the configuration type node, rpc or log. See also use_defaults.")
 	("update_config", "Reads the current node configuration and updates it with missing keys and values and delete keys that are no longer used. Updated configuration is written to stdout.")
@@ -75,6 +82,7 @@ void nano::add_node_options (boost::program_options::options_description & descr
 	("wallet_representative_get", "Prints default representative for <wallet>")
 	("wallet_representative_set", "Set <account> as default representative for <wallet>")
 	("all", "Only valid with --final_vote_clear")
+	("bulk_ingest", "Only valid with --migrate_database_lmdb_to_rocksdb, writes tables into sorted SST files which are ingested directly instead of going through write transactions")
 	("account", boost::program_options::value<std::string> (), "Defines <account> for other commands")
 	("root", boost::program_options::value<std::string> (), "Defines <root> for other commands")
 	("file", boost::program_options::value<std::string> (), "Defines <file> for other commands")
@@ -114,6 +122,7 @@ void nano::add_node_flag_options (boost::program_options::options_description &
 		("disable_block_processor_republishing", "Disables block republishing by disabling the local_block_broadcaster component")
 		("disable_search_pending", "Disables the periodic search for pending transactions")
 		("enable_pruning", "Enable experimental ledger pruning")
+		("verify_ledger_counters", "Verify persisted ledger counters against a full ledger scan in the background after startup")
 		("allow_bootstrap_peers_duplicates", "Allow multiple connections to same peer in bootstrap attempts")
 		("fast_bootstrap", "Increase bootstrap speed for high end nodes with higher limits")
 		("block_processor_batch_size", boost::program_options::value<std::size_t>(), "Increase block processor transaction batch write size, default 0 (limited by config block_processor_batch_max_time), 256k for fast_bootstrap")
@@ -153,6 +162,7 @@ std::error_code nano::update_flags (nano::node_flags & flags_a, boost::program_o
 	flags_a.disable_providing_telemetry_metrics = (vm.count ("disable_providing_telemetry_metrics") > 0);
 	flags_a.disable_block_processor_unchecked_deletion = (vm.count ("disable_block_processor_unchecked_deletion") > 0);
 	flags_a.enable_pruning = (vm.count ("enable_pruning") > 0);
+	flags_a.verify_ledger_counters = (vm.count ("verify_ledger_counters") > 0);
 	flags_a.allow_bootstrap_peers_duplicates = (vm.count ("allow_bootstrap_peers_duplicates") > 0);
 	flags_a.fast_bootstrap = (vm.count ("fast_bootstrap") > 0);
 	if (flags_a.fast_bootstrap)
@@ -490,7 +500,7 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 		auto error (false);
 		if (!node.node->init_error ())
 		{
-			error = node.node->ledger.migrate_lmdb_to_rocksdb (data_path);
+			error = node.node->ledger.migrate_lmdb_to_rocksdb (data_path, vm.count ("bulk_ingest") > 0);
 		}
 		else
 		{
@@ -502,6 +512,90 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 			std::cerr << "There was an error migrating" << std::endl;
 		}
 	}
+	else if (vm.count ("ledger_snapshot_export"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			nano::logger::initialize (nano::log_config::cli_default (), data_path);
+
+			auto node_flags = nano::inactive_node_flag_defaults ();
+			node_flags.read_only = false; // Writers are blocked with a write transaction for the duration of the export
+			nano::update_flags (node_flags, vm);
+			nano::inactive_node node (data_path, node_flags);
+			if (!node.node->init_error ())
+			{
+				nano::store::snapshot snapshot{ node.node->store, node.node->logger };
+				if (snapshot.export_to (vm["file"].as<std::string> (), nano::hardware_concurrency ()))
+				{
+					std::cerr << "Ledger snapshot export failed" << std::endl;
+					ec = nano::error_cli::generic;
+				}
+			}
+			else
+			{
+				ec = nano::error_cli::generic;
+			}
+		}
+		else
+		{
+			std::cerr << "ledger_snapshot_export command requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
+	else if (vm.count ("ledger_snapshot_import"))
+	{
+		if (vm.count ("file") == 1)
+		{
+			nano::logger::initialize (nano::log_config::cli_default (), data_path);
+
+			nano::network_params network_params{ nano::network_constants::active_network };
+			nano::daemon_config config{ data_path, network_params };
+			std::vector<std::string> config_overrides;
+			if (auto config_arg = vm.find ("config"); config_arg != vm.end ())
+			{
+				config_overrides = nano::config_overrides (config_arg->second.as<std::vector<nano::config_key_value_pair>> ());
+			}
+			if (!nano::read_node_config_toml (data_path, config, config_overrides))
+			{
+				// The store is opened directly, a ledger would insert the genesis block into the empty tables
+				auto & logger = nano::default_logger ();
+				auto store = nano::make_store (logger, data_path, network_params.ledger, false, true, config.node.rocksdb_config, config.node.diagnostics_config.txn_tracking, config.node.block_processor_batch_max_time, config.node.lmdb_config);
+				if (!store->init_error ())
+				{
+					nano::store::snapshot snapshot{ *store, logger };
+					if (!snapshot.import_from (vm["file"].as<std::string> ()))
+					{
+						nano::stats stats{ logger };
+						nano::ledger ledger{ *store, stats, network_params.ledger };
+						if (!ledger.verify_counts ())
+						{
+							std::cerr << "Imported ledger counters did not match the ledger contents and were corrected" << std::endl;
+						}
+						std::cout << "Ledger snapshot imported, block count: " << ledger.block_count () << std::endl;
+					}
+					else
+					{
+						std::cerr << "Ledger snapshot import failed" << std::endl;
+						ec = nano::error_cli::generic;
+					}
+				}
+				else
+				{
+					std::cerr << "Error opening database" << std::endl;
+					ec = nano::error_cli::generic;
+				}
+			}
+			else
+			{
+				ec = nano::error_cli::reading_config;
+			}
+		}
+		else
+		{
+			std::cerr << "ledger_snapshot_import command requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
 	else if (vm.count ("unchecked_clear"))
 	{
 		std::filesystem::path data_path = vm.count ("data_path") ? std::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
@@ -602,6 +696,13 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 						else
 						{
 							node.node->store.confirmation_height.clear (transaction, account);
+							node.node->store.unconfirmed.put (transaction, account);
+							// Persisted counters are trusted at startup, remove the blocks which are no longer cemented
+							if (auto counts = node.node->store.counters.get (transaction))
+							{
+								counts->cemented_count -= std::min (counts->cemented_count, confirmation_height_info.height);
+								node.node->store.counters.put (transaction, counts.value ());
+							}
 						}
 
 						std::cout << "Confirmation height of account " << account_str << " is set to " << conf_height_reset_num << std::endl;
@@ -1366,6 +1467,24 @@ void reset_confirmation_heights (nano::store::write_transaction const & transact
 
 	// Then make sure the confirmation height of the genesis account open block is 1
 	store.confirmation_height.put (transaction, constants.genesis->account (), { 1, constants.genesis->hash () });
+
+	// Persisted counters are trusted at startup, only the genesis open block remains cemented
+	if (auto counts = store.counters.get (transaction))
+	{
+		counts->cemented_count = 1;
+		store.counters.put (transaction, counts.value ());
+	}
+
+	// Every account apart from a genesis account with only the open block now has unconfirmed blocks
+	store.unconfirmed.clear (transaction);
+	for (auto i = store.account.begin (transaction), n = store.account.end (); i != n; ++i)
+	{
+		auto const & [account, info] = *i;
+		if (account != constants.genesis->account () || info.block_count > 1)
+		{
+			store.unconfirmed.put (transaction, account);
+		}
+	}
 }
 
 bool is_using_rocksdb (std::filesystem::path const & data_path, boost::program_options::variables_map const & vm, std::error_code & ec)
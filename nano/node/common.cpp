@@ -1,9 +1,11 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/memory.hpp>
+#include <nano/lib/object_pool.hpp>
 #include <nano/lib/stream.hpp>
 #include <nano/node/active_elections.hpp>
 #include <nano/node/common.hpp>
 #include <nano/node/election.hpp>
+#include <nano/node/messages.hpp>
 #include <nano/node/network.hpp>
 #include <nano/node/wallet.hpp>
 
@@ -136,3 +138,17 @@ nano::node_singleton_memory_pool_purge_guard::node_singleton_memory_pool_purge_g
 	cleanup_guard ({ nano::block_memory_pool_purge, nano::purge_shared_ptr_singleton_pool_memory<nano::vote>, nano::purge_shared_ptr_singleton_pool_memory<nano::election> })
 {
 }
+
+std::unique_ptr<nano::container_info_component> nano::collect_object_pool_info (std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (nano::object_pool_stats<nano::keepalive>::collect_container_info ("keepalive"));
+	composite->add_component (nano::object_pool_stats<nano::publish>::collect_container_info ("publish"));
+	composite->add_component (nano::object_pool_stats<nano::confirm_req>::collect_container_info ("confirm_req"));
+	composite->add_component (nano::object_pool_stats<nano::confirm_ack>::collect_container_info ("confirm_ack"));
+	composite->add_component (nano::object_pool_stats<nano::asc_pull_req>::collect_container_info ("asc_pull_req"));
+	composite->add_component (nano::object_pool_stats<nano::asc_pull_ack>::collect_container_info ("asc_pull_ack"));
+	composite->add_component (nano::object_pool_stats<nano::vote>::collect_container_info ("vote"));
+	composite->add_component (nano::object_pool_stats<nano::state_block>::collect_container_info ("state_block"));
+	return composite;
+}
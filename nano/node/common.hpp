@@ -138,4 +138,7 @@ public:
 private:
 	nano::cleanup_guard cleanup_guard;
 };
+
+/** Hit and miss counters of the thread caching pools for network messages, votes and state blocks */
+std::unique_ptr<container_info_component> collect_object_pool_info (std::string const & name);
 }
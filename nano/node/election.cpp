@@ -43,6 +43,10 @@ void nano::election::confirm_once (nano::unique_lock<nano::mutex> & lock_a)
 	nano::unique_lock<nano::mutex> election_winners_lk{ node.active.election_winner_details_mutex };
 	auto just_confirmed = state_m != nano::election_state::confirmed;
 	state_m = nano::election_state::confirmed;
+	if (just_confirmed)
+	{
+		node.active.trigger (qualified_root); // Cleanup is due
+	}
 	if (just_confirmed && (node.active.election_winner_details.count (status.winner->hash ()) == 0))
 	{
 		node.active.election_winner_details.emplace (status.winner->hash (), shared_from_this ());
@@ -168,13 +172,19 @@ void nano::election::send_confirm_req (nano::confirmation_solicitor & solicitor_
 void nano::election::transition_active ()
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
-	state_change (nano::election_state::passive, nano::election_state::active);
+	if (!state_change (nano::election_state::passive, nano::election_state::active))
+	{
+		node.active.trigger (qualified_root);
+	}
 }
 
 void nano::election::cancel ()
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
-	state_change (state_m, nano::election_state::cancelled);
+	if (!state_change (state_m, nano::election_state::cancelled))
+	{
+		node.active.trigger (qualified_root);
+	}
 }
 
 bool nano::election::confirmed_locked () const
@@ -300,6 +310,38 @@ bool nano::election::transition_time (nano::confirmation_solicitor & solicitor_a
 	return result;
 }
 
+std::chrono::steady_clock::time_point nano::election::next_transition_time () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	auto const now = std::chrono::steady_clock::now ();
+	auto result = now;
+	switch (state_m)
+	{
+		case nano::election_state::passive:
+			result = std::chrono::steady_clock::time_point{ state_start } + base_latency () * passive_duration_factor;
+			break;
+		case nano::election_state::active:
+			if (status.winner->hash () != last_block_hash)
+			{
+				break; // Winner needs to be broadcast
+			}
+			result = std::min ({ last_vote + node.config.network_params.network.vote_broadcast_interval,
+			last_block + node.config.network_params.network.block_broadcast_interval,
+			last_req + confirm_req_time () });
+			break;
+		case nano::election_state::confirmed:
+		case nano::election_state::expired_unconfirmed:
+		case nano::election_state::expired_confirmed:
+		case nano::election_state::cancelled:
+			break; // Cleanup is due
+	}
+	if (!confirmed_locked ())
+	{
+		result = std::min (result, election_start + time_to_live ());
+	}
+	return result;
+}
+
 std::chrono::milliseconds nano::election::time_to_live () const
 {
 	switch (behavior ())
@@ -349,25 +391,28 @@ nano::tally_t nano::election::tally () const
 
 nano::tally_t nano::election::tally_impl () const
 {
-	std::unordered_map<nano::block_hash, nano::uint128_t> block_weights;
-	std::unordered_map<nano::block_hash, nano::uint128_t> final_weights_l;
+	// Weights are summed as native integers, only the per block totals are converted
+	std::unordered_map<nano::block_hash, nano::uint128_native_t> block_weights;
+	std::unordered_map<nano::block_hash, nano::uint128_native_t> final_weights_l;
 	for (auto const & [account, info] : last_votes)
 	{
-		auto rep_weight (node.ledger.weight (account));
+		auto rep_weight (node.ledger.weight_native (account));
 		block_weights[info.hash] += rep_weight;
 		if (info.timestamp == std::numeric_limits<uint64_t>::max ())
 		{
 			final_weights_l[info.hash] += rep_weight;
 		}
 	}
-	last_tally = block_weights;
+	last_tally.clear ();
 	nano::tally_t result;
 	for (auto const & [hash, amount] : block_weights)
 	{
+		auto const amount_l = nano::from_native (amount);
+		last_tally.emplace (hash, amount_l);
 		auto block (last_blocks.find (hash));
 		if (block != last_blocks.end ())
 		{
-			result.emplace (amount, block->second);
+			result.emplace (amount_l, block->second);
 		}
 	}
 	// Calculate final votes sum for winner
@@ -377,7 +422,7 @@ nano::tally_t nano::election::tally_impl () const
 		auto find_final (final_weights_l.find (winner_hash));
 		if (find_final != final_weights_l.end ())
 		{
-			final_weight = find_final->second;
+			final_weight = nano::from_native (find_final->second);
 		}
 	}
 	return result;
@@ -402,6 +447,7 @@ void nano::election::confirm_if_quorum (nano::unique_lock<nano::mutex> & lock_a)
 	if (sum >= node.online_reps.delta () && winner_hash_l != status_winner_hash_l)
 	{
 		status.winner = block_l;
+		node.active.trigger (qualified_root); // New winner is due for broadcast
 		remove_votes (status_winner_hash_l);
 		node.block_processor.force (block_l);
 	}
@@ -664,12 +710,12 @@ bool nano::election::replace_by_weight (nano::unique_lock<nano::mutex> & lock_a,
 	std::sort (sorted.begin (), sorted.end (), [] (auto const & left, auto const & right) { return left.second < right.second; });
 
 	auto votes_tally = [this] (std::vector<std::shared_ptr<nano::vote>> const & votes) {
-		nano::uint128_t result{ 0 };
+		nano::uint128_native_t result{ 0 };
 		for (auto const & vote : votes)
 		{
-			result += node.ledger.weight (vote->account);
+			result += node.ledger.weight_native (vote->account);
 		}
-		return result;
+		return nano::from_native (result);
 	};
 
 	// Replace if lowest tally is below inactive cache new block weight
@@ -85,6 +85,8 @@ private: // State management
 
 public: // State transitions
 	bool transition_time (nano::confirmation_solicitor &);
+	/** Earliest time at which `transition_time` has something to do for this election */
+	std::chrono::steady_clock::time_point next_transition_time () const;
 	void transition_active ();
 	void cancel ();
 
@@ -772,8 +772,13 @@ void nano::json_handler::account_move ()
 						auto account (rpc_l->account_impl (i->second.get<std::string> ("")));
 						accounts.push_back (account);
 					}
-					auto transaction (rpc_l->node.wallets.tx_begin_write ());
-					auto error (wallet->store.move (transaction, source->store, accounts));
+					bool error;
+					{
+						auto transaction (rpc_l->node.wallets.tx_begin_write ());
+						error = wallet->store.move (transaction, source->store, accounts);
+					}
+					// Moved accounts may be voting representatives, invalidated once the move is committed
+					rpc_l->node.wallets.invalidate_signing_keys ();
 					rpc_l->response_l.put ("moved", error ? "0" : "1");
 				}
 				else
@@ -797,14 +802,18 @@ void nano::json_handler::account_remove ()
 		auto account (rpc_l->account_impl ());
 		if (!rpc_l->ec)
 		{
-			auto transaction = rpc_l->node.wallets.tx_begin_write ();
-			rpc_l->wallet_locked_impl (transaction, wallet);
-			rpc_l->wallet_account_impl (transaction, wallet, account);
-			if (!rpc_l->ec)
 			{
-				wallet->store.erase (transaction, account);
-				rpc_l->response_l.put ("removed", "1");
+				auto transaction = rpc_l->node.wallets.tx_begin_write ();
+				rpc_l->wallet_locked_impl (transaction, wallet);
+				rpc_l->wallet_account_impl (transaction, wallet, account);
+				if (!rpc_l->ec)
+				{
+					wallet->store.erase (transaction, account);
+					rpc_l->response_l.put ("removed", "1");
+				}
 			}
+			// Removed account may have been a voting representative, invalidated once the removal is committed
+			rpc_l->node.wallets.invalidate_signing_keys ();
 		}
 		rpc_l->response_errors ();
 	}));
@@ -4463,20 +4472,24 @@ void nano::json_handler::wallet_change_seed ()
 			if (!seed.decode_hex (seed_text))
 			{
 				auto count (static_cast<uint32_t> (rpc_l->count_optional_impl (0)));
-				auto transaction (rpc_l->node.wallets.tx_begin_write ());
-				if (wallet->store.valid_password (transaction))
-				{
-					nano::public_key account (wallet->change_seed (transaction, seed, count));
-					rpc_l->response_l.put ("success", "");
-					rpc_l->response_l.put ("last_restored_account", account.to_account ());
-					auto index (wallet->store.deterministic_index_get (transaction));
-					debug_assert (index > 0);
-					rpc_l->response_l.put ("restored_count", std::to_string (index));
-				}
-				else
 				{
-					rpc_l->ec = nano::error_common::wallet_locked;
+					auto transaction (rpc_l->node.wallets.tx_begin_write ());
+					if (wallet->store.valid_password (transaction))
+					{
+						nano::public_key account (wallet->change_seed (transaction, seed, count));
+						rpc_l->response_l.put ("success", "");
+						rpc_l->response_l.put ("last_restored_account", account.to_account ());
+						auto index (wallet->store.deterministic_index_get (transaction));
+						debug_assert (index > 0);
+						rpc_l->response_l.put ("restored_count", std::to_string (index));
+					}
+					else
+					{
+						rpc_l->ec = nano::error_common::wallet_locked;
+					}
 				}
+				// Keys of the previous seed are gone and restored keys may be voting representatives, invalidated once the change is committed
+				rpc_l->node.wallets.invalidate_signing_keys ();
 			}
 			else
 			{
@@ -4524,12 +4537,16 @@ void nano::json_handler::wallet_create ()
 			}
 			if (!rpc_l->ec && seed_text.is_initialized ())
 			{
-				auto transaction (rpc_l->node.wallets.tx_begin_write ());
-				nano::public_key account (wallet->change_seed (transaction, seed));
-				rpc_l->response_l.put ("last_restored_account", account.to_account ());
-				auto index (wallet->store.deterministic_index_get (transaction));
-				debug_assert (index > 0);
-				rpc_l->response_l.put ("restored_count", std::to_string (index));
+				{
+					auto transaction (rpc_l->node.wallets.tx_begin_write ());
+					nano::public_key account (wallet->change_seed (transaction, seed));
+					rpc_l->response_l.put ("last_restored_account", account.to_account ());
+					auto index (wallet->store.deterministic_index_get (transaction));
+					debug_assert (index > 0);
+					rpc_l->response_l.put ("restored_count", std::to_string (index));
+				}
+				// Restored keys may be voting representatives, invalidated once the seed is committed
+				rpc_l->node.wallets.invalidate_signing_keys ();
 			}
 		}
 		rpc_l->response_errors ();
@@ -4735,9 +4752,7 @@ void nano::json_handler::wallet_lock ()
 	auto wallet (wallet_impl ());
 	if (!ec)
 	{
-		nano::raw_key empty;
-		empty.clear ();
-		wallet->store.password.value_set (empty);
+		wallet->lock ();
 		response_l.put ("locked", "1");
 
 		node.logger.warn (nano::log::type::rpc, "Wallet locked");
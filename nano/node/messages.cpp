@@ -547,6 +547,7 @@ bool nano::confirm_req::deserialize (nano::stream & stream_a)
 	try
 	{
 		uint8_t const count = hash_count (header);
+		roots_hashes.reserve (count);
 		for (auto i (0); i != count && !result; ++i)
 		{
 			nano::block_hash block_hash (0);
@@ -615,7 +616,7 @@ void nano::confirm_req::operator() (nano::object_stream & obs) const
 
 nano::confirm_ack::confirm_ack (bool & error_a, nano::stream & stream_a, nano::message_header const & header_a, nano::network_filter::digest_t const & digest_a, nano::vote_uniquer * uniquer_a) :
 	message (header_a),
-	vote{ nano::make_shared<nano::vote> (error_a, stream_a) },
+	vote{ nano::make_pooled<nano::vote> (error_a, stream_a) },
 	digest{ digest_a }
 {
 	if (!error_a && uniquer_a)
@@ -628,20 +629,20 @@ nano::confirm_ack::confirm_ack (nano::network_constants const & constants, std::
 	message (constants, nano::message_type::confirm_ack),
 	vote{ vote_a }
 {
-	debug_assert (vote->hashes.size () < 256);
+	debug_assert (vote->hashes ().size () < 256);
 
 	header.block_type_set (nano::block_type::not_a_block);
 	header.flag_set (rebroadcasted_flag, rebroadcasted_a);
 
-	if (vote->hashes.size () >= 16)
+	if (vote->hashes ().size () >= 16)
 	{
 		// Set v2 flag and use extended count if there are more than 15 hashes
 		header.confirm_set_v2 (true);
-		header.count_v2_set (static_cast<uint8_t> (vote->hashes.size ()));
+		header.count_v2_set (static_cast<uint8_t> (vote->hashes ().size ()));
 	}
 	else
 	{
-		header.count_set (static_cast<uint8_t> (vote->hashes.size ()));
+		header.count_set (static_cast<uint8_t> (vote->hashes ().size ()));
 	}
 }
 
@@ -9,6 +9,7 @@
 #include <nano/lib/memory.hpp>
 #include <nano/lib/network_filter.hpp>
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/object_pool.hpp>
 #include <nano/lib/object_stream.hpp>
 #include <nano/lib/stats_enums.hpp>
 #include <nano/lib/stream.hpp>
@@ -161,7 +162,7 @@ public: // Logging
  * Header extensions:
  * - No specific bits from the `extensions` field are used for `keepalive`.
  */
-class keepalive final : public message
+class keepalive final : public message, public nano::pooled<keepalive>
 {
 public:
 	explicit keepalive (nano::network_constants const & constants);
@@ -186,7 +187,7 @@ public: // Logging
  * - [0x0f00] Block type: Identifies the specific type of the block.
  * - [0x0004] Originator flag
  */
-class publish final : public message
+class publish final : public message, public nano::pooled<publish>
 {
 public:
 	publish (bool &, nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest = 0, nano::block_uniquer * = nullptr);
@@ -224,7 +225,7 @@ public: // Logging
  * - [0x0001] Confirm V2 flag
  * - [0x0002] Reserved for V3+ versioning
  */
-class confirm_req final : public message
+class confirm_req final : public message, public nano::pooled<confirm_req>
 {
 public:
 	confirm_req (bool & error, nano::stream &, nano::message_header const &);
@@ -264,7 +265,7 @@ public: // Logging
  * - [0x0002] Reserved for V3+ versioning
  * - [0x0004] Rebroadcasted flag
  */
-class confirm_ack final : public message
+class confirm_ack final : public message, public nano::pooled<confirm_ack>
 {
 public:
 	confirm_ack (bool & error, nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest = 0, nano::vote_uniquer * = nullptr);
@@ -554,7 +555,7 @@ struct empty_payload
 /**
  * Ascending bootstrap pull request
  */
-class asc_pull_req final : public message
+class asc_pull_req final : public message, public nano::pooled<asc_pull_req>
 {
 public:
 	using id_t = uint64_t;
@@ -648,7 +649,7 @@ public: // Logging
 /**
  * Ascending bootstrap pull response
  */
-class asc_pull_ack final : public message
+class asc_pull_ack final : public message, public nano::pooled<asc_pull_ack>
 {
 public:
 	using id_t = asc_pull_req::id_t;
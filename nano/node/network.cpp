@@ -233,9 +233,10 @@ void nano::network::send_keepalive_self (std::shared_ptr<nano::transport::channe
 
 void nano::network::flood_message (nano::message & message_a, nano::transport::buffer_drop_policy const drop_policy_a, float const scale_a)
 {
+	auto const buffer = message_a.to_shared_const_buffer (); // Serialize once for all peers
 	for (auto & i : list (fanout (scale_a)))
 	{
-		i->send (message_a, nullptr, drop_policy_a);
+		i->send (buffer, message_a, nullptr, drop_policy_a);
 	}
 }
 
@@ -262,31 +263,34 @@ void nano::network::flood_block (std::shared_ptr<nano::block> const & block, nan
 void nano::network::flood_block_initial (std::shared_ptr<nano::block> const & block)
 {
 	nano::publish message{ node.network_params.network, block, /* is_originator */ true };
+	auto const buffer = message.to_shared_const_buffer ();
 	for (auto const & rep : node.rep_crawler.principal_representatives ())
 	{
-		rep.channel->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+		rep.channel->send (buffer, message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
 	}
 	for (auto & peer : list_non_pr (fanout (1.0)))
 	{
-		peer->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+		peer->send (buffer, message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
 	}
 }
 
 void nano::network::flood_vote (std::shared_ptr<nano::vote> const & vote, float scale, bool rebroadcasted)
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
+	auto const buffer = message.to_shared_const_buffer ();
 	for (auto & i : list (fanout (scale)))
 	{
-		i->send (message, nullptr);
+		i->send (buffer, message, nullptr);
 	}
 }
 
 void nano::network::flood_vote_pr (std::shared_ptr<nano::vote> const & vote, bool rebroadcasted)
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
+	auto const buffer = message.to_shared_const_buffer ();
 	for (auto const & i : node.rep_crawler.principal_representatives ())
 	{
-		i.channel->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+		i.channel->send (buffer, message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
 	}
 }
 
@@ -1,4 +1,5 @@
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/io_shards.hpp>
 #include <nano/lib/stream.hpp>
 #include <nano/lib/thread_runner.hpp>
 #include <nano/lib/tomlconfig.hpp>
@@ -19,6 +20,7 @@
 #include <nano/node/node.hpp>
 #include <nano/node/peer_history.hpp>
 #include <nano/node/portmapping.hpp>
+#include <nano/node/pruning_queue.hpp>
 #include <nano/node/request_aggregator.hpp>
 #include <nano/node/scheduler/component.hpp>
 #include <nano/node/scheduler/hinted.hpp>
@@ -73,6 +75,8 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	logger{ make_logger_identifier (node_id) },
 	runner_impl{ std::make_unique<nano::thread_runner> (io_ctx_shared, logger, config.io_threads) },
 	runner{ *runner_impl },
+	io_shards_impl{ std::make_unique<nano::io_shards> (config.io_shards, logger) },
+	io_shards{ *io_shards_impl },
 	node_initialized_latch (1),
 	network_params{ config.network_params },
 	stats{ logger, config.stats_config },
@@ -85,12 +89,12 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	distributed_work (*this),
 	store_impl (nano::make_store (logger, application_path_a, network_params.ledger, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade, flags.force_use_write_queue)),
 	store (*store_impl),
-	unchecked{ config.max_unchecked_blocks, stats, flags.disable_block_processor_unchecked_deletion },
+	unchecked{ config.max_unchecked_memory, stats, flags.disable_block_processor_unchecked_deletion },
 	wallets_store_impl (std::make_unique<nano::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config)),
 	wallets_store (*wallets_store_impl),
-	ledger_impl{ std::make_unique<nano::ledger> (store, stats, network_params.ledger, flags_a.generate_cache, config_a.representative_vote_weight_minimum.number ()) },
+	ledger_impl{ std::make_unique<nano::ledger> (store, stats, network_params.ledger, flags_a.generate_cache, config_a.representative_vote_weight_minimum.number (), config_a.block_filter_memory) },
 	ledger{ *ledger_impl },
-	outbound_limiter_impl{ std::make_unique<nano::bandwidth_limiter> (config) },
+	outbound_limiter_impl{ std::make_unique<nano::bandwidth_limiter> (config, stats) },
 	outbound_limiter{ *outbound_limiter_impl },
 	message_processor_impl{ std::make_unique<nano::message_processor> (config.message_processor, *this) },
 	message_processor{ *message_processor_impl },
@@ -154,6 +158,8 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	peer_history{ *peer_history_impl },
 	monitor_impl{ std::make_unique<nano::monitor> (config.monitor, *this) },
 	monitor{ *monitor_impl },
+	pruning_queue_impl{ std::make_unique<nano::pruning_queue> () },
+	pruning_queue{ *pruning_queue_impl },
 	startup_time (std::chrono::steady_clock::now ()),
 	node_seq (seq)
 {
@@ -184,6 +190,18 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 		}
 	});
 
+	if (flags.enable_pruning)
+	{
+		// Cemented blocks become pruning candidates once they are old or deep enough
+		confirming_set.batch_cemented.add ([this] (nano::confirming_set::cemented_notification const & notification) {
+			uint64_t const max_depth (config.max_pruning_depth != 0 ? config.max_pruning_depth : std::numeric_limits<uint64_t>::max ());
+			for (auto const & [block, confirmation_root] : notification.cemented)
+			{
+				pruning_queue.push (block->account (), block->sideband ().timestamp, 1, max_depth);
+			}
+		});
+	}
+
 	if (!init_error ())
 	{
 		// Notify election schedulers when AEC frees election slot
@@ -322,7 +340,7 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 
 		if (!is_initialized && !flags.read_only)
 		{
-			auto const transaction (store.tx_begin_write ({ tables::accounts, tables::blocks, tables::confirmation_height, tables::rep_weights }));
+			auto const transaction (store.tx_begin_write ({ tables::accounts, tables::blocks, tables::confirmation_height, tables::meta, tables::rep_weights }));
 			// Store was empty meaning we just created it, add the genesis block
 			store.initialize (transaction, ledger.cache, ledger.constants);
 		}
@@ -524,7 +542,10 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (no
 	composite->add_component (node.ledger.collect_container_info ("ledger"));
 	composite->add_component (collect_container_info (node.active, "active"));
 	composite->add_component (node.tcp_listener.collect_container_info ("tcp_listener"));
+	composite->add_component (node.io_shards.collect_container_info ("io_shards"));
 	composite->add_component (collect_container_info (node.network, "network"));
+	composite->add_component (node.outbound_limiter.collect_container_info ("outbound_limiter"));
+	composite->add_component (nano::collect_object_pool_info ("object_pools"));
 	composite->add_component (node.telemetry.collect_container_info ("telemetry"));
 	composite->add_component (node.workers.collect_container_info ("workers"));
 	composite->add_component (node.bootstrap_workers.collect_container_info ("bootstrap_workers"));
@@ -549,10 +570,12 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (no
 	composite->add_component (node.generator.collect_container_info ("vote_generator"));
 	composite->add_component (node.final_generator.collect_container_info ("vote_generator_final"));
 	composite->add_component (node.ascendboot.collect_container_info ("bootstrap_ascending"));
+	composite->add_component (node.bootstrap_server.collect_container_info ("bootstrap_server"));
 	composite->add_component (node.unchecked.collect_container_info ("unchecked"));
 	composite->add_component (node.local_block_broadcaster.collect_container_info ("local_block_broadcaster"));
 	composite->add_component (node.rep_tiers.collect_container_info ("rep_tiers"));
 	composite->add_component (node.message_processor.collect_container_info ("message_processor"));
+	composite->add_component (node.pruning_queue.collect_container_info ("pruning_queue"));
 	return composite;
 }
 
@@ -570,7 +593,7 @@ void nano::node::process_active (std::shared_ptr<nano::block> const & incoming)
 
 nano::block_status nano::node::process (std::shared_ptr<nano::block> block)
 {
-	auto const transaction = ledger.tx_begin_write ({ tables::accounts, tables::blocks, tables::pending, tables::rep_weights }, nano::store::writer::node);
+	auto const transaction = ledger.tx_begin_write ({ tables::accounts, tables::blocks, tables::meta, tables::pending, tables::rep_weights, tables::unconfirmed }, nano::store::writer::node);
 	return process (transaction, block);
 }
 
@@ -598,6 +621,24 @@ void nano::node::start ()
 			this_l->ongoing_ledger_pruning ();
 		});
 	}
+	if (flags.verify_ledger_counters)
+	{
+		auto this_l (shared ());
+		workers.push_task ([this_l] () {
+			this_l->logger.info (nano::log::type::ledger, "Verifying ledger counters...");
+			if (this_l->ledger.verify_counts ())
+			{
+				this_l->logger.info (nano::log::type::ledger, "Ledger counters verified");
+			}
+			else
+			{
+				this_l->logger.error (nano::log::type::ledger, "Ledger counters were inconsistent and have been corrected (blocks: {}, accounts: {}, cemented: {})",
+				this_l->ledger.block_count (),
+				this_l->ledger.account_count (),
+				this_l->ledger.cemented_count ());
+			}
+		});
+	}
 	if (!flags.disable_rep_crawler)
 	{
 		rep_crawler.start ();
@@ -713,7 +754,8 @@ void nano::node::stop ()
 
 	// work pool is not stopped on purpose due to testing setup
 
-	// Stop the IO runner last
+	// Stop the IO runners last
+	io_shards.stop ();
 	runner.join ();
 	debug_assert (io_ctx_shared.use_count () == 1); // Node should be the last user of the io_context
 }
@@ -819,47 +861,79 @@ void nano::node::search_receivable_all ()
 	});
 }
 
-bool nano::node::collect_ledger_pruning_targets (std::deque<nano::block_hash> & pruning_targets_a, nano::account & last_account_a, uint64_t const batch_read_size_a, uint64_t const max_depth_a, uint64_t const cutoff_time_a)
+namespace
 {
-	uint64_t read_operations (0);
-	bool finish_transaction (false);
-	auto transaction = ledger.tx_begin_read ();
-	for (auto i (store.confirmation_height.begin (transaction, last_account_a)), n (store.confirmation_height.end ()); i != n && !finish_transaction;)
+struct pruning_walk
+{
+	nano::block_hash target{ 0 }; // First block old or deep enough to be pruned, zero if none
+	uint64_t depth{ 0 };
+	uint64_t remaining{ 0 }; // Number of unpruned blocks left behind, excluding the frontier
+	uint64_t remaining_timestamp{ 0 }; // Timestamp of the oldest of them
+};
+
+/*
+ * Walks back from the confirmed frontier of an account until reaching a block old or deep enough to be pruned.
+ * Blocks before that one are pruned together with it, the frontier itself is never pruned.
+ */
+pruning_walk walk_pruning_target (nano::ledger & ledger, nano::secure::read_transaction & transaction, nano::block_hash const & frontier, uint64_t const batch_read_size, uint64_t const max_depth, uint64_t const cutoff_time)
+{
+	pruning_walk result;
+	nano::block_hash hash (frontier);
+	while (!hash.is_zero () && result.depth < max_depth)
 	{
-		++read_operations;
-		auto const & account (i->first);
-		nano::block_hash hash (i->second.frontier);
-		uint64_t depth (0);
-		while (!hash.is_zero () && depth < max_depth_a)
+		auto block = ledger.any.block_get (transaction, hash);
+		if (block != nullptr)
 		{
-			auto block = ledger.any.block_get (transaction, hash);
-			if (block != nullptr)
+			if (block->sideband ().timestamp > cutoff_time || result.depth == 0)
 			{
-				if (block->sideband ().timestamp > cutoff_time_a || depth == 0)
+				if (result.depth != 0)
 				{
-					hash = block->previous ();
-				}
-				else
-				{
-					break;
+					++result.remaining;
+					result.remaining_timestamp = block->sideband ().timestamp;
 				}
+				hash = block->previous ();
 			}
 			else
 			{
-				release_assert (depth != 0);
-				hash = 0;
-			}
-			if (++depth % batch_read_size_a == 0)
-			{
-				// FIXME: This is triggering an assertion where the iterator is still used after transaction is refreshed
-				transaction.refresh ();
+				break;
 			}
 		}
-		if (!hash.is_zero ())
+		else
+		{
+			release_assert (result.depth != 0);
+			hash = 0;
+		}
+		if (++result.depth % batch_read_size == 0)
 		{
-			pruning_targets_a.push_back (hash);
+			// FIXME: This is triggering an assertion where the iterator is still used after transaction is refreshed
+			transaction.refresh ();
 		}
-		read_operations += depth;
+	}
+	result.target = hash;
+	return result;
+}
+}
+
+bool nano::node::collect_ledger_pruning_targets (std::deque<nano::block_hash> & pruning_targets_a, nano::account & last_account_a, uint64_t const batch_read_size_a, uint64_t const max_depth_a, uint64_t const cutoff_time_a)
+{
+	uint64_t read_operations (0);
+	bool finish_transaction (false);
+	auto transaction = ledger.tx_begin_read ();
+	for (auto i (store.confirmation_height.begin (transaction, last_account_a)), n (store.confirmation_height.end ()); i != n && !finish_transaction;)
+	{
+		++read_operations;
+		auto const & account (i->first);
+		auto walk = walk_pruning_target (ledger, transaction, i->second.frontier, batch_read_size_a, max_depth_a, cutoff_time_a);
+		if (!walk.target.is_zero ())
+		{
+			pruning_targets_a.push_back (walk.target);
+		}
+		// Blocks too young to be pruned now are picked up from the queue once they age
+		if (walk.remaining > 0)
+		{
+			pruning_queue.push (account, walk.remaining_timestamp, walk.remaining, max_depth_a);
+		}
+		read_operations += walk.depth;
 		if (read_operations >= batch_read_size_a)
 		{
 			last_account_a = account.number () + 1;
@@ -873,10 +947,41 @@ bool nano::node::collect_ledger_pruning_targets (std::deque<nano::block_hash> &
 	return !finish_transaction || last_account_a.is_zero ();
 }
 
+bool nano::node::collect_queued_pruning_targets (std::deque<nano::block_hash> & pruning_targets_a, uint64_t const batch_read_size_a, uint64_t const max_depth_a, uint64_t const cutoff_time_a)
+{
+	auto accounts = pruning_queue.pop (cutoff_time_a, batch_read_size_a);
+	auto transaction = ledger.tx_begin_read ();
+	for (auto const & account : accounts)
+	{
+		auto info = store.confirmation_height.get (transaction, account);
+		if (!info)
+		{
+			continue;
+		}
+		auto walk = walk_pruning_target (ledger, transaction, info->frontier, batch_read_size_a, max_depth_a, cutoff_time_a);
+		if (!walk.target.is_zero ())
+		{
+			pruning_targets_a.push_back (walk.target);
+		}
+		if (walk.remaining > 0)
+		{
+			pruning_queue.push (account, walk.remaining_timestamp, walk.remaining, max_depth_a);
+		}
+	}
+	// Remaining queued accounts are not old enough yet
+	return accounts.size () < batch_read_size_a;
+}
+
 void nano::node::ledger_pruning (uint64_t const batch_size_a, bool bootstrap_weight_reached_a)
 {
 	uint64_t const max_depth (config.max_pruning_depth != 0 ? config.max_pruning_depth : std::numeric_limits<uint64_t>::max ());
 	uint64_t const cutoff_time (bootstrap_weight_reached_a ? nano::seconds_since_epoch () - config.max_pruning_age.count () : std::numeric_limits<uint64_t>::max ());
+	// The whole ledger is scanned once, afterwards candidates are fed by cementing. Rescan if the queue could not keep track of all of them.
+	bool const full_scan (!pruning_scanned || pruning_queue.overflowed ());
+	if (full_scan)
+	{
+		pruning_queue.clear ();
+	}
 	uint64_t pruned_count (0);
 	uint64_t transaction_write_count (0);
 	nano::account last_account (1); // 0 Burn account is never opened. So it can be used to break loop
@@ -887,8 +992,17 @@ void nano::node::ledger_pruning (uint64_t const batch_size_a, bool bootstrap_wei
 		// Search pruning targets
 		while (pruning_targets.size () < batch_size_a && !target_finished && !stopped)
 		{
-			target_finished = collect_ledger_pruning_targets (pruning_targets, last_account, batch_size_a * 2, max_depth, cutoff_time);
+			if (full_scan)
+			{
+				target_finished = collect_ledger_pruning_targets (pruning_targets, last_account, batch_size_a * 2, max_depth, cutoff_time);
+			}
+			else
+			{
+				target_finished = collect_queued_pruning_targets (pruning_targets, batch_size_a * 2, max_depth, cutoff_time);
+			}
 		}
+		// Process targets in key order to improve write locality
+		std::sort (pruning_targets.begin (), pruning_targets.end ());
 		// Pruning write operation
 		transaction_write_count = 0;
 		if (!pruning_targets.empty () && !stopped)
@@ -906,8 +1020,12 @@ void nano::node::ledger_pruning (uint64_t const batch_size_a, bool bootstrap_wei
 			logger.debug (nano::log::type::prunning, "Pruned blocks: {}", pruned_count);
 		}
 	}
+	if (full_scan && !stopped)
+	{
+		pruning_scanned = true;
+	}
 
-	logger.debug (nano::log::type::prunning, "Total recently pruned block count: {}", pruned_count);
+	logger.debug (nano::log::type::prunning, "Total recently pruned block count: {} (queued accounts: {})", pruned_count, pruning_queue.size ());
 }
 
 void nano::node::ongoing_ledger_pruning ()
@@ -49,6 +49,8 @@ class vote_router;
 class work_pool;
 class peer_history;
 class port_mapping;
+class pruning_queue;
+class io_shards;
 class thread_runner;
 
 namespace scheduler
@@ -105,6 +107,7 @@ public:
 	void backup_wallet ();
 	void search_receivable_all ();
 	bool collect_ledger_pruning_targets (std::deque<nano::block_hash> &, nano::account &, uint64_t const, uint64_t const, uint64_t const);
+	bool collect_queued_pruning_targets (std::deque<nano::block_hash> &, uint64_t const, uint64_t const, uint64_t const);
 	void ledger_pruning (uint64_t const, bool);
 	void ongoing_ledger_pruning ();
 	int price (nano::uint128_t const &, int);
@@ -148,6 +151,8 @@ public:
 	nano::logger logger;
 	std::unique_ptr<nano::thread_runner> runner_impl;
 	nano::thread_runner & runner;
+	std::unique_ptr<nano::io_shards> io_shards_impl;
+	nano::io_shards & io_shards;
 	boost::latch node_initialized_latch;
 	nano::network_params & network_params;
 	nano::stats stats;
@@ -221,6 +226,8 @@ public:
 	nano::peer_history & peer_history;
 	std::unique_ptr<nano::monitor> monitor_impl;
 	nano::monitor & monitor;
+	std::unique_ptr<nano::pruning_queue> pruning_queue_impl;
+	nano::pruning_queue & pruning_queue;
 
 public:
 	std::chrono::steady_clock::time_point const startup_time;
@@ -251,6 +258,8 @@ public: // Testing convenience functions
 private:
 	void long_inactivity_cleanup ();
 
+	std::atomic<bool> pruning_scanned{ false };
+
 	static std::string make_logger_identifier (nano::keypair const & node_id);
 };
 
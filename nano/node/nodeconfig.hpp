@@ -74,6 +74,8 @@ public:
 	nano::amount rep_crawler_weight_minimum{ "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF" };
 	std::chrono::milliseconds vote_generator_delay{ std::chrono::milliseconds (100) };
 	unsigned vote_generator_threshold{ 3 };
+	/** Number of threads signing votes for each vote generator, votes are still recorded and sent in the order they were requested */
+	unsigned vote_generator_threads{ std::min (nano::hardware_concurrency (), 4u) };
 	nano::amount online_weight_minimum{ 60000 * nano::Gxrb_ratio };
 	/*
 	 * The minimum vote weight that a representative must have for its vote to be counted.
@@ -82,6 +84,8 @@ public:
 	nano::amount representative_vote_weight_minimum{ 10 * nano::Mxrb_ratio };
 	unsigned password_fanout{ 1024 };
 	unsigned io_threads{ env_io_threads ().value_or (std::max (4u, nano::hardware_concurrency ())) };
+	/** Number of IO shards serving peering sockets, 0 keeps all sockets on the shared IO threads */
+	unsigned io_shards{ 0 };
 	unsigned network_threads{ std::max (4u, nano::hardware_concurrency ()) };
 	unsigned work_threads{ std::max (4u, nano::hardware_concurrency ()) };
 	unsigned background_threads{ std::max (4u, nano::hardware_concurrency ()) };
@@ -121,6 +125,8 @@ public:
 	std::size_t bootstrap_bandwidth_limit{ 5 * 1024 * 1024 };
 	/** Bootstrap traffic does not need bursts */
 	double bootstrap_bandwidth_burst_ratio{ 1. };
+	/** Principal representative channels get four times the bandwidth share of other channels, to keep votes flowing under load */
+	std::size_t bandwidth_limit_pr_share{ 4 };
 	nano::bootstrap_ascending_config bootstrap_ascending;
 	nano::bootstrap_server_config bootstrap_server;
 	std::chrono::milliseconds confirming_set_batch_time{ 250 };
@@ -128,7 +134,9 @@ public:
 	double max_work_generate_multiplier{ 64. };
 	uint32_t max_queued_requests{ 512 };
 	unsigned request_aggregator_threads{ std::min (nano::hardware_concurrency (), 4u) }; // Max 4 threads if available
-	unsigned max_unchecked_blocks{ 65536 };
+	std::size_t max_unchecked_memory{ 32 * 1024 * 1024 };
+	/** Size in bytes of the in-memory filter that answers lookups for missing blocks without querying the database, zero disables it */
+	std::size_t block_filter_memory{ 0 };
 	std::chrono::seconds max_pruning_age{ !network_params.network.is_beta_network () ? std::chrono::seconds (24 * 60 * 60) : std::chrono::seconds (5 * 60) }; // 1 day; 5 minutes for beta network
 	uint64_t max_pruning_depth{ 0 };
 	nano::rocksdb_config rocksdb_config;
@@ -185,6 +193,7 @@ public:
 	bool force_use_write_queue{ false }; // For testing only. RocksDB does not use the database queue, but some tests rely on it being used.
 	bool disable_search_pending{ false }; // For testing only
 	bool enable_pruning{ false };
+	bool verify_ledger_counters{ false };
 	bool fast_bootstrap{ false };
 	bool read_only{ false };
 	bool disable_connection_cleanup{ false };
@@ -8,98 +8,130 @@ nano::online_reps::online_reps (nano::ledger & ledger_a, nano::node_config const
 	ledger{ ledger_a },
 	config{ config_a }
 {
+	nano::lock_guard<nano::mutex> lock{ mutex };
 	if (!ledger.store.init_error ())
 	{
 		auto transaction (ledger.store.tx_begin_read ());
-		trended_m = calculate_trend (transaction);
+		load_samples (transaction);
 	}
+	trended_m = calculate_trend ();
+	update ();
 }
 
 void nano::online_reps::observe (nano::account const & rep_a)
 {
-	if (ledger.weight (rep_a) > 0)
+	auto const weight = ledger.weight (rep_a);
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	auto const online_l = online_m;
+	auto now = std::chrono::steady_clock::now ();
+	// Replace the weight previously counted for this representative, it changes as the ledger progresses
+	auto & by_account = reps.get<tag_account> ();
+	if (auto existing = by_account.find (rep_a); existing != by_account.end ())
 	{
-		nano::lock_guard<nano::mutex> lock{ mutex };
-		auto now = std::chrono::steady_clock::now ();
-		auto new_insert = reps.get<tag_account> ().erase (rep_a) == 0;
-		reps.insert ({ now, rep_a });
-		auto cutoff = reps.get<tag_time> ().lower_bound (now - std::chrono::seconds (config.network_params.node.weight_period));
-		auto trimmed = reps.get<tag_time> ().begin () != cutoff;
-		reps.get<tag_time> ().erase (reps.get<tag_time> ().begin (), cutoff);
-		if (new_insert || trimmed)
-		{
-			online_m = calculate_online ();
-		}
+		online_m -= existing->weight;
+		by_account.erase (existing);
+	}
+	// A representative whose weight was delegated away no longer counts as online
+	if (weight > 0)
+	{
+		reps.insert ({ now, rep_a, weight });
+		online_m += weight;
+	}
+	auto & by_time = reps.get<tag_time> ();
+	auto cutoff = by_time.lower_bound (now - std::chrono::seconds (config.network_params.node.weight_period));
+	for (auto i = by_time.begin (); i != cutoff; ++i)
+	{
+		online_m -= i->weight;
+	}
+	by_time.erase (by_time.begin (), cutoff);
+	if (online_m != online_l)
+	{
+		update ();
 	}
 }
 
 void nano::online_reps::sample ()
 {
-	nano::unique_lock<nano::mutex> lock{ mutex };
-	nano::uint128_t online_l = online_m;
-	lock.unlock ();
-	nano::uint128_t trend_l;
+	auto transaction (ledger.store.tx_begin_write ({ tables::online_weight }));
+	std::vector<uint64_t> discarded;
+	uint64_t const timestamp = std::chrono::system_clock::now ().time_since_epoch ().count ();
+	nano::uint128_t online_l;
 	{
-		auto transaction (ledger.store.tx_begin_write ({ tables::online_weight }));
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		online_l = online_m;
+		// Samples are mirrored in memory, reload them if the table was modified elsewhere, e.g. cleared after a long period of inactivity
+		auto & by_timestamp = samples.get<tag_timestamp> ();
+		auto oldest (ledger.store.online_weight.begin (transaction));
+		auto const table_empty = oldest == ledger.store.online_weight.end ();
+		if (table_empty != samples.empty () || (!table_empty && oldest->first != by_timestamp.begin ()->timestamp))
+		{
+			load_samples (transaction);
+		}
 		// Discard oldest entries
-		while (ledger.store.online_weight.count (transaction) >= config.network_params.node.max_weight_samples)
+		while (samples.size () >= config.network_params.node.max_weight_samples)
 		{
-			auto oldest (ledger.store.online_weight.begin (transaction));
-			debug_assert (oldest != ledger.store.online_weight.end ());
-			ledger.store.online_weight.del (transaction, oldest->first);
+			discarded.push_back (by_timestamp.begin ()->timestamp);
+			by_timestamp.erase (by_timestamp.begin ());
 		}
-		ledger.store.online_weight.put (transaction, std::chrono::system_clock::now ().time_since_epoch ().count (), online_l);
-		trend_l = calculate_trend (transaction);
+		by_timestamp.erase (timestamp);
+		samples.insert ({ timestamp, online_l });
+		trended_m = calculate_trend ();
+		update ();
+	}
+	for (auto const & item : discarded)
+	{
+		ledger.store.online_weight.del (transaction, item);
 	}
-	lock.lock ();
-	trended_m = trend_l;
+	ledger.store.online_weight.put (transaction, timestamp, online_l);
 }
 
-nano::uint128_t nano::online_reps::calculate_online () const
+void nano::online_reps::load_samples (store::transaction const & transaction_a)
 {
-	nano::uint128_t current;
-	for (auto & i : reps)
+	debug_assert (!mutex.try_lock ());
+	samples.clear ();
+	for (auto i (ledger.store.online_weight.begin (transaction_a)), n (ledger.store.online_weight.end ()); i != n; ++i)
 	{
-		current += ledger.weight (i.account);
+		samples.insert ({ i->first, i->second.number () });
 	}
-	return current;
 }
 
-nano::uint128_t nano::online_reps::calculate_trend (store::transaction & transaction_a) const
+nano::uint128_t nano::online_reps::calculate_trend () const
 {
-	std::vector<nano::uint128_t> items;
-	items.reserve (config.network_params.node.max_weight_samples + 1);
-	items.push_back (config.online_weight_minimum.number ());
-	for (auto i (ledger.store.online_weight.begin (transaction_a)), n (ledger.store.online_weight.end ()); i != n; ++i)
+	// Pick median value for our target vote weight, out of the samples and the configured minimum
+	auto const & by_weight = samples.get<tag_weight> ();
+	auto const minimum = config.online_weight_minimum.number ();
+	auto const median_idx = (by_weight.size () + 1) / 2;
+	// Position the minimum would take among the samples sorted by weight
+	auto const minimum_idx = by_weight.rank (by_weight.lower_bound (minimum));
+	if (median_idx == minimum_idx)
 	{
-		items.push_back (i->second.number ());
+		return minimum;
 	}
-	nano::uint128_t result;
-	// Pick median value for our target vote weight
-	auto median_idx = items.size () / 2;
-	nth_element (items.begin (), items.begin () + median_idx, items.end ());
-	result = items[median_idx];
-	return result;
+	return by_weight.nth (median_idx < minimum_idx ? median_idx : median_idx - 1)->weight;
+}
+
+void nano::online_reps::update ()
+{
+	debug_assert (!mutex.try_lock ());
+	// Using a larger container to ensure maximum precision
+	auto weight = static_cast<nano::uint256_t> (std::max ({ online_m, trended_m, config.online_weight_minimum.number () }));
+	auto delta_l = ((weight * online_weight_quorum) / 100).convert_to<nano::uint128_t> ();
+	published.store (online_m, trended_m, delta_l);
 }
 
 nano::uint128_t nano::online_reps::trended () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return trended_m;
+	return published.load (published_weights::index::trended);
 }
 
 nano::uint128_t nano::online_reps::online () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return online_m;
+	return published.load (published_weights::index::online);
 }
 
 nano::uint128_t nano::online_reps::delta () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	// Using a larger container to ensure maximum precision
-	auto weight = static_cast<nano::uint256_t> (std::max ({ online_m, trended_m, config.online_weight_minimum.number () }));
-	return ((weight * online_weight_quorum) / 100).convert_to<nano::uint128_t> ();
+	return published.load (published_weights::index::delta);
 }
 
 std::vector<nano::account> nano::online_reps::list ()
@@ -115,18 +147,58 @@ void nano::online_reps::clear ()
 	nano::lock_guard<nano::mutex> lock{ mutex };
 	reps.clear ();
 	online_m = 0;
+	update ();
 }
 
 std::unique_ptr<nano::container_info_component> nano::collect_container_info (online_reps & online_reps, std::string const & name)
 {
 	std::size_t count;
+	std::size_t samples_count;
 	{
 		nano::lock_guard<nano::mutex> guard{ online_reps.mutex };
 		count = online_reps.reps.size ();
+		samples_count = online_reps.samples.size ();
 	}
 
 	auto sizeof_element = sizeof (decltype (online_reps.reps)::value_type);
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "reps", count, sizeof_element }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "samples", samples_count, sizeof (decltype (online_reps.samples)::value_type) }));
 	return composite;
 }
+
+/*
+ * published_weights
+ */
+
+void nano::online_reps::published_weights::store (nano::uint128_t const & online, nano::uint128_t const & trended, nano::uint128_t const & delta)
+{
+	auto const sequence_l = sequence.load (std::memory_order_relaxed);
+	// An odd sequence marks a write in progress
+	sequence.store (sequence_l + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence (std::memory_order_release);
+	std::size_t i = 0;
+	for (auto const & value : { online, trended, delta })
+	{
+		auto const native = nano::to_native (value);
+		words[i++].store (static_cast<uint64_t> (native >> 64), std::memory_order_relaxed);
+		words[i++].store (static_cast<uint64_t> (native & std::numeric_limits<uint64_t>::max ()), std::memory_order_relaxed);
+	}
+	sequence.store (sequence_l + 2, std::memory_order_release);
+}
+
+nano::uint128_t nano::online_reps::published_weights::load (index index_a) const
+{
+	auto const i = 2 * static_cast<std::size_t> (index_a);
+	while (true)
+	{
+		auto const sequence_l = sequence.load (std::memory_order_acquire);
+		auto const high = words[i].load (std::memory_order_relaxed);
+		auto const low = words[i + 1].load (std::memory_order_relaxed);
+		std::atomic_thread_fence (std::memory_order_acquire);
+		if ((sequence_l & 1) == 0 && sequence.load (std::memory_order_relaxed) == sequence_l)
+		{
+			return nano::from_native ((nano::uint128_native_t{ high } << 64) | low);
+		}
+	}
+}
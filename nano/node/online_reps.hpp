@@ -7,8 +7,11 @@
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/ranked_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -21,12 +24,18 @@ namespace store
 	class transaction;
 }
 
-/** Track online representatives and trend online weight */
+/**
+ * Track online representatives and trend online weight
+ * Online weight is kept up to date as representatives are observed or time out, and the trend is the median of weight samples
+ * kept in memory alongside the `online_weight` table. Trended, online and quorum weights can be read without locking.
+ * A representative counts with the weight it had when it last voted, so weight delegated to or away from it is only reflected once it votes again
+ * or times out after `weight_period`.
+ */
 class online_reps final
 {
 public:
 	online_reps (nano::ledger & ledger_a, nano::node_config const & config_a);
-	/** Add voting account \p rep_account to the set of online representatives */
+	/** Add voting account \p rep_account to the set of online representatives, or refresh its weight if already online */
 	void observe (nano::account const & rep_account);
 	/** Called periodically to sample online weight */
 	void sample ();
@@ -47,6 +56,13 @@ private:
 	public:
 		std::chrono::steady_clock::time_point time;
 		nano::account account;
+		nano::uint128_t weight; // Weight counted towards online weight when last observed
+	};
+	class sample_info
+	{
+	public:
+		uint64_t timestamp;
+		nano::uint128_t weight;
 	};
 	class tag_time
 	{
@@ -54,8 +70,38 @@ private:
 	class tag_account
 	{
 	};
-	nano::uint128_t calculate_trend (store::transaction &) const;
-	nano::uint128_t calculate_online () const;
+	class tag_timestamp
+	{
+	};
+	class tag_weight
+	{
+	};
+
+	/**
+	 * Online, trended and quorum weights, written while holding the mutex and read without locking
+	 * Readers retry while a write is in progress (sequence lock)
+	 */
+	class published_weights
+	{
+	public:
+		enum class index
+		{
+			online,
+			trended,
+			delta,
+		};
+		void store (nano::uint128_t const & online, nano::uint128_t const & trended, nano::uint128_t const & delta);
+		nano::uint128_t load (index) const;
+
+	private:
+		std::atomic<uint64_t> sequence{ 0 };
+		std::array<std::atomic<uint64_t>, 6> words{};
+	};
+
+	void load_samples (store::transaction const &);
+	nano::uint128_t calculate_trend () const;
+	/** Recalculates quorum and publishes weights, must be called with the mutex held */
+	void update ();
 	mutable nano::mutex mutex;
 	nano::ledger & ledger;
 	nano::node_config const & config;
@@ -66,9 +112,16 @@ private:
 	boost::multi_index::hashed_unique<boost::multi_index::tag<tag_account>,
 	boost::multi_index::member<rep_info, nano::account, &rep_info::account>>>>
 	reps;
+	boost::multi_index_container<sample_info,
+	boost::multi_index::indexed_by<
+	boost::multi_index::ordered_unique<boost::multi_index::tag<tag_timestamp>,
+	boost::multi_index::member<sample_info, uint64_t, &sample_info::timestamp>>,
+	boost::multi_index::ranked_non_unique<boost::multi_index::tag<tag_weight>,
+	boost::multi_index::member<sample_info, nano::uint128_t, &sample_info::weight>>>>
+	samples;
 	nano::uint128_t trended_m;
 	nano::uint128_t online_m;
-	nano::uint128_t minimum;
+	published_weights published;
 
 	friend class election_quorum_minimum_update_weight_before_quorum_checks_Test;
 	friend std::unique_ptr<container_info_component> collect_container_info (online_reps & online_reps, std::string const & name);
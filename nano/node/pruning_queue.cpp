@@ -0,0 +1,86 @@
+#include <nano/lib/utility.hpp>
+#include <nano/node/pruning_queue.hpp>
+
+nano::pruning_queue::pruning_queue (std::size_t max_size_a) :
+	max_size{ max_size_a }
+{
+}
+
+void nano::pruning_queue::push (nano::account const & account, uint64_t timestamp, uint64_t blocks, uint64_t max_depth)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+
+	auto & by_account = entries.get<tag_account> ();
+	auto existing = by_account.find (account);
+	if (existing != by_account.end ())
+	{
+		by_account.modify (existing, [&] (entry & entry) {
+			entry.timestamp = std::min (entry.timestamp, timestamp);
+			entry.blocks += blocks;
+		});
+	}
+	else if (entries.size () < max_size)
+	{
+		existing = by_account.insert ({ account, timestamp, blocks }).first;
+	}
+	else
+	{
+		overflow = true;
+		return;
+	}
+
+	// Deep enough chains are prunable immediately, move them to the front
+	if (existing->blocks >= max_depth && existing->timestamp != 0)
+	{
+		by_account.modify (existing, [] (entry & entry) {
+			entry.timestamp = 0;
+		});
+	}
+}
+
+std::deque<nano::account> nano::pruning_queue::pop (uint64_t cutoff, std::size_t count)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+
+	std::deque<nano::account> result;
+	auto & by_timestamp = entries.get<tag_timestamp> ();
+	while (!by_timestamp.empty () && by_timestamp.begin ()->timestamp <= cutoff && result.size () < count)
+	{
+		result.push_back (by_timestamp.begin ()->account);
+		by_timestamp.erase (by_timestamp.begin ());
+	}
+	return result;
+}
+
+void nano::pruning_queue::clear ()
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	entries.clear ();
+	overflow = false;
+}
+
+bool nano::pruning_queue::overflowed () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return overflow;
+}
+
+std::size_t nano::pruning_queue::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return entries.size ();
+}
+
+bool nano::pruning_queue::empty () const
+{
+	return size () == 0;
+}
+
+std::unique_ptr<nano::container_info_component> nano::pruning_queue::collect_container_info (std::string const & name) const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", entries.size (), sizeof (decltype (entries)::value_type) }));
+	return composite;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/secure/common.hpp>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <deque>
+
+namespace mi = boost::multi_index;
+
+namespace nano
+{
+class container_info_component;
+}
+
+namespace nano
+{
+/*
+ * Accounts with cemented blocks that are not pruned yet, ordered by the timestamp of their oldest unpruned block.
+ * Fed by cementing so ongoing pruning only revisits accounts that received new confirmations instead of rescanning the whole ledger.
+ * The queue is bounded, once an account cannot be inserted `overflowed` is set and a full ledger scan is required to find all candidates again.
+ */
+class pruning_queue final
+{
+public:
+	explicit pruning_queue (std::size_t max_size = 1024 * 1024);
+
+	/**
+	 * Queues account, keeping the older timestamp if the account is already queued
+	 * @param blocks Number of unpruned blocks added to the account
+	 * @param max_depth Once this many blocks are queued the account is eligible for pruning regardless of age
+	 */
+	void push (nano::account const &, uint64_t timestamp, uint64_t blocks, uint64_t max_depth);
+	/** Removes and returns up to `count` accounts with timestamps not newer than `cutoff` */
+	std::deque<nano::account> pop (uint64_t cutoff, std::size_t count);
+	void clear ();
+	bool overflowed () const;
+	std::size_t size () const;
+	bool empty () const;
+
+	std::unique_ptr<container_info_component> collect_container_info (std::string const & name) const;
+
+private:
+	struct entry
+	{
+		nano::account account;
+		uint64_t timestamp;
+		uint64_t blocks;
+	};
+
+	// clang-format off
+	class tag_account {};
+	class tag_timestamp {};
+
+	using ordered_entries = boost::multi_index_container<entry,
+	mi::indexed_by<
+		mi::ordered_non_unique<mi::tag<tag_timestamp>,
+			mi::member<entry, uint64_t, &entry::timestamp>>,
+		mi::hashed_unique<mi::tag<tag_account>,
+			mi::member<entry, nano::account, &entry::account>>
+	>>;
+	// clang-format on
+
+	ordered_entries entries;
+	std::size_t const max_size;
+	bool overflow{ false };
+
+	mutable nano::mutex mutex;
+};
+}
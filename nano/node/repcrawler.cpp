@@ -1,4 +1,5 @@
 #include <nano/node/active_elections.hpp>
+#include <nano/node/bandwidth_limiter.hpp>
 #include <nano/node/node.hpp>
 #include <nano/node/repcrawler.hpp>
 #include <nano/secure/ledger.hpp>
@@ -157,6 +158,8 @@ void nano::rep_crawler::run ()
 			node.keepalive_preconfigured ();
 		}
 
+		update_principals ();
+
 		lock.lock ();
 
 		condition.wait_for (lock, query_interval (sufficient_weight), [this, sufficient_weight] {
@@ -229,6 +232,26 @@ void nano::rep_crawler::cleanup ()
 	});
 }
 
+// Favor principal representative channels when dividing outbound bandwidth
+void nano::rep_crawler::update_principals ()
+{
+	std::vector<std::shared_ptr<nano::transport::channel>> principals;
+	std::vector<nano::transport::channel const *> current;
+	for (auto const & rep : principal_representatives ())
+	{
+		principals.push_back (rep.channel);
+		current.push_back (rep.channel.get ());
+	}
+	std::sort (current.begin (), current.end ());
+	current.erase (std::unique (current.begin (), current.end ()), current.end ());
+	// Only update the limiter on changes, principal representatives rarely change channels
+	if (current != last_principals)
+	{
+		node.outbound_limiter.set_principals (principals);
+		last_principals = std::move (current);
+	}
+}
+
 std::vector<std::shared_ptr<nano::transport::channel>> nano::rep_crawler::prepare_crawl_targets (bool sufficient_weight) const
 {
 	debug_assert (!mutex.try_lock ());
@@ -399,7 +422,7 @@ bool nano::rep_crawler::process (std::shared_ptr<nano::vote> const & vote, std::
 	{
 		// TODO: This linear search could be slow, especially with large votes.
 		auto const target_hash = it->hash;
-		bool found = std::any_of (vote->hashes.begin (), vote->hashes.end (), [&target_hash] (nano::block_hash const & hash) {
+		bool found = std::any_of (vote->hashes ().begin (), vote->hashes ().end (), [&target_hash] (nano::block_hash const & hash) {
 			return hash == target_hash;
 		});
 		if (found)
@@ -424,15 +447,15 @@ bool nano::rep_crawler::process (std::shared_ptr<nano::vote> const & vote, std::
 nano::uint128_t nano::rep_crawler::total_weight () const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
-	nano::uint128_t result = 0;
+	nano::uint128_native_t result = 0;
 	for (const auto & rep : reps)
 	{
 		if (rep.channel->alive ())
 		{
-			result += node.ledger.weight (rep.account);
+			result += node.ledger.weight_native (rep.account);
 		}
 	}
-	return result;
+	return nano::from_native (result);
 }
 
 std::vector<nano::representative> nano::rep_crawler::representatives (std::size_t count, nano::uint128_t const minimum_weight, std::optional<decltype (nano::network_constants::protocol_version)> const & minimum_protocol_version)
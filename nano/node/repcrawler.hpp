@@ -98,6 +98,7 @@ private: // Dependencies
 private:
 	void run ();
 	void cleanup ();
+	void update_principals ();
 	void validate_and_process (nano::unique_lock<nano::mutex> &);
 	bool query_predicate (bool sufficient_weight) const;
 	std::chrono::milliseconds query_interval (bool sufficient_weight) const;
@@ -176,6 +177,8 @@ private:
 	boost::circular_buffer<response_t> responses{ max_responses };
 
 	std::chrono::steady_clock::time_point last_query{};
+	/** Principal representative channels last passed to the outbound bandwidth limiter */
+	std::vector<nano::transport::channel const *> last_principals;
 
 	std::atomic<bool> stopped{ false };
 	nano::condition_variable condition;
@@ -121,6 +121,25 @@ void nano::scheduler::bucket::update ()
 bool nano::scheduler::bucket::push (uint64_t time, std::shared_ptr<nano::block> block)
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
+	return push_impl (time, std::move (block));
+}
+
+std::vector<bool> nano::scheduler::bucket::push (std::vector<std::pair<uint64_t, std::shared_ptr<nano::block>>> const & blocks)
+{
+	std::vector<bool> result;
+	result.reserve (blocks.size ());
+
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	for (auto const & [time, block] : blocks)
+	{
+		result.push_back (push_impl (time, block));
+	}
+	return result;
+}
+
+bool nano::scheduler::bucket::push_impl (uint64_t time, std::shared_ptr<nano::block> block)
+{
+	debug_assert (!mutex.try_lock ());
 
 	auto [it, inserted] = queue.insert ({ time, block });
 	release_assert (!queue.empty ());
@@ -14,6 +14,7 @@
 #include <deque>
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace mi = boost::multi_index;
 
@@ -63,6 +64,11 @@ public:
 	void update ();
 
 	bool push (uint64_t time, std::shared_ptr<nano::block> block);
+	/**
+	 * Pushes multiple blocks while holding the bucket lock only once
+	 * @return a flag per entry, set if the corresponding block was added
+	 */
+	std::vector<bool> push (std::vector<std::pair<uint64_t, std::shared_ptr<nano::block>>> const & blocks);
 
 	size_t size () const;
 	size_t election_count () const;
@@ -72,6 +78,7 @@ public:
 	void dump () const;
 
 private:
+	bool push_impl (uint64_t time, std::shared_ptr<nano::block> block);
 	bool election_vacancy (priority_t candidate) const;
 	bool election_overfill () const;
 	void cancel_lowest_election ();
@@ -40,6 +40,7 @@ nano::scheduler::priority::priority (nano::node & node_a, nano::stats & stats_a)
 	{
 		auto bucket = std::make_unique<scheduler::bucket> (minimums[i], node.config.priority_bucket, node.active, stats);
 		buckets.emplace_back (std::move (bucket));
+		bucket_minimums.push_back (nano::to_native (minimums[i]));
 	}
 }
 
@@ -101,44 +102,131 @@ bool nano::scheduler::priority::activate (secure::transaction const & transactio
 
 bool nano::scheduler::priority::activate (secure::transaction const & transaction, nano::account const & account, nano::account_info const & account_info, nano::confirmation_height_info const & conf_info)
 {
-	debug_assert (conf_info.frontier != account_info.head);
+	if (auto candidate = find_candidate (transaction, account, account_info, conf_info))
+	{
+		auto & bucket = find_bucket (candidate->priority.number_native ());
+		bool added = bucket.push (candidate->time, candidate->block);
+		activated (*candidate, added);
+		if (added)
+		{
+			notify ();
+		}
+		return true; // Activated
+	}
 
-	auto hash = conf_info.height == 0 ? account_info.open_block : node.ledger.any.block_successor (transaction, conf_info.frontier).value ();
-	auto block = node.ledger.any.block_get (transaction, hash);
-	release_assert (block != nullptr);
+	stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_failed);
+	return false; // Not activated
+}
+
+std::size_t nano::scheduler::priority::activate_many (secure::transaction const & transaction, std::vector<nano::account> accounts)
+{
+	// Visiting accounts in key order keeps consecutive ledger lookups close together in the underlying B-tree
+	std::sort (accounts.begin (), accounts.end ());
+	accounts.erase (std::unique (accounts.begin (), accounts.end ()), accounts.end ());
 
-	if (node.ledger.dependents_confirmed (transaction, *block))
+	std::vector<account_state> states;
+	states.reserve (accounts.size ());
+	for (auto const & account : accounts)
 	{
-		auto const balance = block->balance ();
-		auto const previous_balance = node.ledger.any.block_balance (transaction, conf_info.frontier).value_or (0);
-		auto const balance_priority = std::max (balance, previous_balance);
+		debug_assert (!account.is_zero ());
+		auto info = node.ledger.any.account_get (transaction, account);
+		if (!info)
+		{
+			stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_skip);
+			continue;
+		}
+		nano::confirmation_height_info conf_info;
+		node.store.confirmation_height.get (transaction, account, conf_info);
+		states.push_back ({ account, *info, conf_info });
+	}
+	return activate_many (transaction, std::move (states));
+}
 
-		bool added = false;
+std::size_t nano::scheduler::priority::activate_many (secure::transaction const & transaction, std::vector<account_state> accounts)
+{
+	// Visiting accounts in key order keeps consecutive ledger lookups close together in the underlying B-tree
+	std::sort (accounts.begin (), accounts.end (), [] (auto const & a, auto const & b) { return a.account < b.account; });
+
+	std::map<bucket *, std::vector<candidate>> grouped;
+	std::size_t result = 0;
+	for (auto const & [account, info, conf_info] : accounts)
+	{
+		debug_assert (!account.is_zero ());
+		if (conf_info.height >= info.block_count)
 		{
-			auto & bucket = find_bucket (balance_priority);
-			added = bucket.push (account_info.modified, block);
+			stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_skip);
+			continue;
 		}
-		if (added)
+		if (auto candidate = find_candidate (transaction, account, info, conf_info))
 		{
-			node.stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activated);
-			node.logger.trace (nano::log::type::election_scheduler, nano::log::detail::block_activated,
-			nano::log::arg{ "account", account.to_account () }, // TODO: Convert to lazy eval
-			nano::log::arg{ "block", block },
-			nano::log::arg{ "time", account_info.modified },
-			nano::log::arg{ "priority", balance_priority });
-
-			notify ();
+			grouped[&find_bucket (candidate->priority.number_native ())].push_back (std::move (*candidate));
+			++result;
 		}
 		else
 		{
-			node.stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_full);
+			stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_failed);
 		}
+	}
 
-		return true; // Activated
+	bool any_added = false;
+	for (auto const & [bucket, candidates] : grouped)
+	{
+		std::vector<std::pair<uint64_t, std::shared_ptr<nano::block>>> blocks;
+		blocks.reserve (candidates.size ());
+		for (auto const & candidate : candidates)
+		{
+			blocks.emplace_back (candidate.time, candidate.block);
+		}
+		auto added = bucket->push (blocks);
+		debug_assert (added.size () == candidates.size ());
+		for (std::size_t i = 0; i < candidates.size (); ++i)
+		{
+			activated (candidates[i], added[i]);
+			any_added |= added[i];
+		}
+	}
+	if (any_added)
+	{
+		notify ();
 	}
+	return result;
+}
 
-	stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_failed);
-	return false; // Not activated
+auto nano::scheduler::priority::find_candidate (secure::transaction const & transaction, nano::account const & account, nano::account_info const & account_info, nano::confirmation_height_info const & conf_info) const -> std::optional<candidate>
+{
+	debug_assert (conf_info.frontier != account_info.head);
+
+	auto hash = conf_info.height == 0 ? account_info.open_block : node.ledger.any.block_successor (transaction, conf_info.frontier).value ();
+	auto block = node.ledger.any.block_get (transaction, hash);
+	release_assert (block != nullptr);
+
+	if (!node.ledger.dependents_confirmed (transaction, *block))
+	{
+		return std::nullopt;
+	}
+
+	auto const balance = block->balance ();
+	auto const previous_balance = node.ledger.any.block_balance (transaction, conf_info.frontier).value_or (0);
+	auto const balance_priority = std::max (balance, previous_balance);
+
+	return candidate{ account, account_info.modified, block, balance_priority };
+}
+
+void nano::scheduler::priority::activated (candidate const & candidate, bool added)
+{
+	if (added)
+	{
+		node.stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activated);
+		node.logger.trace (nano::log::type::election_scheduler, nano::log::detail::block_activated,
+		nano::log::arg{ "account", candidate.account.to_account () }, // TODO: Convert to lazy eval
+		nano::log::arg{ "block", candidate.block },
+		nano::log::arg{ "time", candidate.time },
+		nano::log::arg{ "priority", candidate.priority });
+	}
+	else
+	{
+		node.stats.inc (nano::stat::type::election_scheduler, nano::stat::detail::activate_full);
+	}
 }
 
 void nano::scheduler::priority::notify ()
@@ -219,14 +307,11 @@ void nano::scheduler::priority::run_cleanup ()
 	}
 }
 
-auto nano::scheduler::priority::find_bucket (nano::uint128_t priority) -> bucket &
+auto nano::scheduler::priority::find_bucket (nano::uint128_native_t priority) -> bucket &
 {
-	auto it = std::upper_bound (buckets.begin (), buckets.end (), priority, [] (nano::uint128_t const & priority, std::unique_ptr<bucket> const & bucket) {
-		return priority < bucket->minimum_balance;
-	});
-	release_assert (it != buckets.begin ()); // There should always be a bucket with a minimum_balance of 0
-	it = std::prev (it);
-	return **it;
+	auto it = std::upper_bound (bucket_minimums.begin (), bucket_minimums.end (), priority);
+	release_assert (it != bucket_minimums.begin ()); // There should always be a bucket with a minimum_balance of 0
+	return *buckets[std::distance (bucket_minimums.begin (), it) - 1];
 }
 
 std::unique_ptr<nano::container_info_component> nano::scheduler::priority::collect_container_info (std::string const & name) const
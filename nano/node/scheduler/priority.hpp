@@ -2,17 +2,19 @@
 
 #include <nano/lib/numbers.hpp>
 #include <nano/node/scheduler/bucket.hpp>
+#include <nano/secure/account_info.hpp>
+#include <nano/secure/common.hpp>
 
 #include <condition_variable>
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace nano
 {
-class account_info;
-class confirmation_height_info;
 class block;
 class container_info_component;
 class node;
@@ -50,6 +52,23 @@ public:
 	 */
 	bool activate (secure::transaction const &, nano::account const &);
 	bool activate (secure::transaction const &, nano::account const &, nano::account_info const &, nano::confirmation_height_info const &);
+	/**
+	 * Activates the first unconfirmed block of each account in \p accounts
+	 * Accounts are looked up in key order and blocks are pushed with a single lock per bucket, followed by a single notification
+	 * @return number of accounts activated
+	 */
+	std::size_t activate_many (secure::transaction const &, std::vector<nano::account> accounts);
+
+	/** Account together with its account info and confirmation height, as already read by the caller */
+	class account_state
+	{
+	public:
+		nano::account account;
+		nano::account_info info;
+		nano::confirmation_height_info conf_info;
+	};
+	/** Same as above, without reading the account info and confirmation height of each account again */
+	std::size_t activate_many (secure::transaction const &, std::vector<account_state> accounts);
 
 	void notify ();
 	std::size_t size () const;
@@ -62,14 +81,29 @@ private: // Dependencies
 	nano::node & node;
 	nano::stats & stats;
 
+private:
+	struct candidate
+	{
+		nano::account account;
+		uint64_t time;
+		std::shared_ptr<nano::block> block;
+		nano::amount priority;
+	};
+
+	/** Returns the first unconfirmed block of the account, provided all its dependencies are confirmed */
+	std::optional<candidate> find_candidate (secure::transaction const &, nano::account const &, nano::account_info const &, nano::confirmation_height_info const &) const;
+	void activated (candidate const &, bool added);
+
 private:
 	void run ();
 	void run_cleanup ();
 	bool predicate () const;
-	bucket & find_bucket (nano::uint128_t priority);
+	bucket & find_bucket (nano::uint128_native_t priority);
 
 private:
 	std::vector<std::unique_ptr<bucket>> buckets;
+	/** Minimum balance of each bucket, kept contiguous for bucket lookups */
+	std::vector<nano::uint128_native_t> bucket_minimums;
 
 	bool stopped{ false };
 	nano::condition_variable condition;
@@ -16,11 +16,13 @@ nano::transport::channel::channel (nano::node & node_a) :
 
 void nano::transport::channel::send (nano::message & message_a, std::function<void (boost::system::error_code const &, std::size_t)> const & callback_a, nano::transport::buffer_drop_policy drop_policy_a, nano::transport::traffic_type traffic_type)
 {
-	auto buffer = message_a.to_shared_const_buffer ();
+	send (message_a.to_shared_const_buffer (), message_a, callback_a, drop_policy_a, traffic_type);
+}
 
-	bool is_droppable_by_limiter = (drop_policy_a == nano::transport::buffer_drop_policy::limiter);
-	bool should_pass = node.outbound_limiter.should_pass (buffer.size (), traffic_type);
-	bool pass = !is_droppable_by_limiter || should_pass;
+void nano::transport::channel::send (nano::shared_const_buffer const & buffer, nano::message const & message_a, std::function<void (boost::system::error_code const &, std::size_t)> const & callback_a, nano::transport::buffer_drop_policy drop_policy_a, nano::transport::traffic_type traffic_type)
+{
+	// Buffers which cannot be dropped by the limiter always pass, but still use up bandwidth of the traffic type and channel
+	bool pass = node.outbound_limiter.should_pass (buffer.size (), traffic_type, this, drop_policy_a);
 
 	node.stats.inc (pass ? nano::stat::type::message : nano::stat::type::drop, to_stat_detail (message_a.type ()), nano::stat::dir::out, /* aggregate all */ true);
 	node.logger.trace (nano::log::type::channel_sent, to_log_detail (message_a.type ()),
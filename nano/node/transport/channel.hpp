@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nano/lib/id_dispenser.hpp>
 #include <nano/lib/locks.hpp>
 #include <nano/lib/object_stream.hpp>
 #include <nano/lib/stats.hpp>
@@ -31,6 +32,15 @@ public:
 	nano::transport::buffer_drop_policy policy_a = nano::transport::buffer_drop_policy::limiter,
 	nano::transport::traffic_type = nano::transport::traffic_type::generic);
 
+	/**
+	 * Sends a message that was already serialized with `message.to_shared_const_buffer ()`
+	 * Allows sending the same message to many channels without serializing it again for each one
+	 */
+	void send (nano::shared_const_buffer const & buffer, nano::message const & message_a,
+	std::function<void (boost::system::error_code const &, std::size_t)> const & callback_a = nullptr,
+	nano::transport::buffer_drop_policy policy_a = nano::transport::buffer_drop_policy::limiter,
+	nano::transport::traffic_type = nano::transport::traffic_type::generic);
+
 	// TODO: investigate clang-tidy warning about default parameters on virtual/override functions
 	virtual void send_buffer (nano::shared_const_buffer const &,
 	std::function<void (boost::system::error_code const &, std::size_t)> const & = nullptr,
@@ -132,6 +142,8 @@ public:
 
 	mutable nano::mutex channel_mutex;
 
+	nano::id_t const id{ nano::next_id () }; // Stable identity, the address of a destroyed channel can be reused by a new one
+
 private:
 	std::chrono::steady_clock::time_point last_bootstrap_attempt{ std::chrono::steady_clock::time_point () };
 	std::chrono::steady_clock::time_point last_packet_received{ std::chrono::steady_clock::now () };
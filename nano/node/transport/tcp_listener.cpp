@@ -1,5 +1,6 @@
 #include <nano/lib/enum_util.hpp>
 #include <nano/lib/interval.hpp>
+#include <nano/lib/io_shards.hpp>
 #include <nano/node/messages.hpp>
 #include <nano/node/node.hpp>
 #include <nano/node/transport/tcp_listener.hpp>
@@ -12,6 +13,17 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+#if defined(__linux__) && defined(SO_REUSEPORT)
+// Linux balances incoming connections between all listening sockets bound to the same port with this option
+using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+bool constexpr reuse_port_supported = true;
+#else
+bool constexpr reuse_port_supported = false;
+#endif
+}
+
 /*
  * tcp_listener
  */
@@ -22,9 +34,7 @@ nano::transport::tcp_listener::tcp_listener (uint16_t port_a, tcp_config const &
 	stats{ node_a.stats },
 	logger{ node_a.logger },
 	port{ port_a },
-	strand{ node_a.io_ctx.get_executor () },
-	acceptor{ strand },
-	task{ strand }
+	strand{ node_a.io_ctx.get_executor () }
 {
 	connection_accepted.add ([this] (auto const & socket, auto const & server) {
 		node.observers.socket_connected.notify (*socket);
@@ -34,7 +44,7 @@ nano::transport::tcp_listener::tcp_listener (uint16_t port_a, tcp_config const &
 nano::transport::tcp_listener::~tcp_listener ()
 {
 	debug_assert (!cleanup_thread.joinable ());
-	debug_assert (!task.joinable ());
+	debug_assert (std::none_of (acceptors.begin (), acceptors.end (), [] (auto const & entry) { return entry->task.joinable (); }));
 	debug_assert (connection_count () == 0);
 	debug_assert (attempt_count () == 0);
 }
@@ -42,23 +52,43 @@ nano::transport::tcp_listener::~tcp_listener ()
 void nano::transport::tcp_listener::start ()
 {
 	debug_assert (!cleanup_thread.joinable ());
-	debug_assert (!task.joinable ());
+	debug_assert (acceptors.empty ());
+
+	bool const sharded = !node.io_shards.empty ();
+	bool const shard_acceptors = sharded && reuse_port_supported;
 
 	try
 	{
-		asio::ip::tcp::endpoint target{ asio::ip::address_v6::any (), port };
+		auto port_l = port;
+		for (std::size_t i = 0, n = shard_acceptors ? node.io_shards.size () : 1; i < n; ++i)
+		{
+			auto & entry = *acceptors.emplace_back (std::make_unique<acceptor_context> (shard_acceptors ? node.io_shards.get (i) : node.io_ctx));
+			entry.distribute = sharded && !shard_acceptors;
+
+			asio::ip::tcp::endpoint target{ asio::ip::address_v6::any (), port_l };
+
+			entry.acceptor.open (target.protocol ());
+			entry.acceptor.set_option (asio::ip::tcp::acceptor::reuse_address (true));
+#if defined(__linux__) && defined(SO_REUSEPORT)
+			if (shard_acceptors)
+			{
+				entry.acceptor.set_option (reuse_port (true));
+			}
+#endif
+			entry.acceptor.bind (target);
+			entry.acceptor.listen (asio::socket_base::max_listen_connections);
 
-		acceptor.open (target.protocol ());
-		acceptor.set_option (asio::ip::tcp::acceptor::reuse_address (true));
-		acceptor.bind (target);
-		acceptor.listen (asio::socket_base::max_listen_connections);
+			// Remaining acceptors bind to the port picked for the first one
+			port_l = entry.acceptor.local_endpoint ().port ();
+		}
 
 		{
 			std::lock_guard<nano::mutex> lock{ mutex };
-			local = acceptor.local_endpoint ();
+			local = acceptors.front ()->acceptor.local_endpoint ();
 		}
 
-		logger.debug (nano::log::type::tcp_listener, "Listening for incoming connections on: {}", fmt::streamed (acceptor.local_endpoint ()));
+		logger.debug (nano::log::type::tcp_listener, "Listening for incoming connections on: {} (acceptors: {}, IO shards: {})",
+		fmt::streamed (acceptors.front ()->acceptor.local_endpoint ()), acceptors.size (), node.io_shards.size ());
 	}
 	catch (boost::system::system_error const & ex)
 	{
@@ -66,35 +96,39 @@ void nano::transport::tcp_listener::start ()
 		throw;
 	}
 
-	task = nano::async::task (strand, [this] () -> asio::awaitable<void> {
-		try
-		{
-			logger.debug (nano::log::type::tcp_listener, "Starting acceptor");
-
+	for (auto & entry_ptr : acceptors)
+	{
+		auto & entry = *entry_ptr;
+		entry.task = nano::async::task (entry.strand, [this, &entry] () -> asio::awaitable<void> {
 			try
 			{
-				co_await run ();
+				logger.debug (nano::log::type::tcp_listener, "Starting acceptor");
+
+				try
+				{
+					co_await run (entry);
+				}
+				catch (boost::system::system_error const & ex)
+				{
+					// Operation aborted is expected when cancelling the acceptor
+					debug_assert (ex.code () == asio::error::operation_aborted);
+				}
+				debug_assert (entry.strand.running_in_this_thread ());
+
+				logger.debug (nano::log::type::tcp_listener, "Stopped acceptor");
 			}
-			catch (boost::system::system_error const & ex)
+			catch (std::exception const & ex)
 			{
-				// Operation aborted is expected when cancelling the acceptor
-				debug_assert (ex.code () == asio::error::operation_aborted);
+				logger.critical (nano::log::type::tcp_listener, "Error: {}", ex.what ());
+				release_assert (false); // Unexpected error
 			}
-			debug_assert (strand.running_in_this_thread ());
-
-			logger.debug (nano::log::type::tcp_listener, "Stopped acceptor");
-		}
-		catch (std::exception const & ex)
-		{
-			logger.critical (nano::log::type::tcp_listener, "Error: {}", ex.what ());
-			release_assert (false); // Unexpected error
-		}
-		catch (...)
-		{
-			logger.critical (nano::log::type::tcp_listener, "Unknown error");
-			release_assert (false); // Unexpected error
-		}
-	});
+			catch (...)
+			{
+				logger.critical (nano::log::type::tcp_listener, "Unknown error");
+				release_assert (false); // Unexpected error
+			}
+		});
+	}
 
 	cleanup_thread = std::thread ([this] {
 		nano::thread_role::set (nano::thread_role::name::tcp_listener);
@@ -115,21 +149,27 @@ void nano::transport::tcp_listener::stop ()
 	}
 	condition.notify_all ();
 
-	if (task.joinable ())
+	for (auto & entry : acceptors)
 	{
-		task.cancel ();
-		task.join ();
+		if (entry->task.joinable ())
+		{
+			entry->task.cancel ();
+			entry->task.join ();
+		}
 	}
 	if (cleanup_thread.joinable ())
 	{
 		cleanup_thread.join ();
 	}
 
-	boost::system::error_code ec;
-	acceptor.close (ec); // Best effort to close the acceptor, ignore errors
-	if (ec)
+	for (auto & entry : acceptors)
 	{
-		logger.error (nano::log::type::tcp_listener, "Error while closing acceptor: {}", ec.message ());
+		boost::system::error_code ec;
+		entry->acceptor.close (ec); // Best effort to close the acceptor, ignore errors
+		if (ec)
+		{
+			logger.error (nano::log::type::tcp_listener, "Error while closing acceptor: {}", ec.message ());
+		}
 	}
 
 	decltype (connections) connections_l;
@@ -301,18 +341,18 @@ auto nano::transport::tcp_listener::connect_impl (asio::ip::tcp::endpoint endpoi
 	}
 }
 
-asio::awaitable<void> nano::transport::tcp_listener::run ()
+asio::awaitable<void> nano::transport::tcp_listener::run (acceptor_context & entry)
 {
-	debug_assert (strand.running_in_this_thread ());
+	debug_assert (entry.strand.running_in_this_thread ());
 
-	while (!stopped && acceptor.is_open ())
+	while (!stopped && entry.acceptor.is_open ())
 	{
 		co_await wait_available_slots ();
 
 		try
 		{
-			auto socket = co_await accept_socket ();
-			debug_assert (strand.running_in_this_thread ());
+			auto socket = co_await accept_socket (entry);
+			debug_assert (entry.strand.running_in_this_thread ());
 
 			auto result = accept_one (std::move (socket), connection_type::inbound);
 			if (result.result != accept_result::accepted)
@@ -337,18 +377,24 @@ asio::awaitable<void> nano::transport::tcp_listener::run ()
 	}
 }
 
-asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::accept_socket ()
+asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::accept_socket (acceptor_context & entry)
 {
-	debug_assert (strand.running_in_this_thread ());
+	debug_assert (entry.strand.running_in_this_thread ());
 
-	co_return co_await acceptor.async_accept (asio::use_awaitable);
+	if (entry.distribute)
+	{
+		auto socket = co_await entry.acceptor.async_accept (node.io_shards.next (), asio::use_awaitable);
+		co_return asio::ip::tcp::socket{ std::move (socket) };
+	}
+	co_return co_await entry.acceptor.async_accept (asio::use_awaitable);
 }
 
 asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::connect_socket (asio::ip::tcp::endpoint endpoint)
 {
 	debug_assert (strand.running_in_this_thread ());
 
-	asio::ip::tcp::socket raw_socket{ strand };
+	// Outgoing sockets are spread between IO shards, the coroutine itself keeps running on the listener strand
+	auto raw_socket = node.io_shards.empty () ? asio::ip::tcp::socket{ strand } : asio::ip::tcp::socket{ node.io_shards.next () };
 	co_await raw_socket.async_connect (endpoint, asio::use_awaitable);
 
 	co_return raw_socket;
@@ -16,6 +16,7 @@
 #include <list>
 #include <string_view>
 #include <thread>
+#include <vector>
 
 namespace mi = boost::multi_index;
 namespace asio = boost::asio;
@@ -50,6 +51,8 @@ public:
 
 /**
  * Server side portion of tcp sessions. Listens for new socket connections and spawns tcp_server objects when connected.
+ * With IO shards configured, sockets are placed on the shards. Where SO_REUSEPORT is supported, each shard accepts on its own listening socket bound to the same port,
+ * otherwise a single listening socket spreads accepted sockets between shards.
  */
 class tcp_listener final
 {
@@ -97,7 +100,9 @@ private: // Dependencies
 	nano::logger & logger;
 
 private:
-	asio::awaitable<void> run ();
+	struct acceptor_context;
+
+	asio::awaitable<void> run (acceptor_context &);
 	asio::awaitable<void> wait_available_slots () const;
 
 	void run_cleanup ();
@@ -124,7 +129,7 @@ private:
 
 	accept_return accept_one (asio::ip::tcp::socket, connection_type);
 	accept_result check_limits (asio::ip::address const & ip, connection_type);
-	asio::awaitable<asio::ip::tcp::socket> accept_socket ();
+	asio::awaitable<asio::ip::tcp::socket> accept_socket (acceptor_context &);
 
 	size_t count_per_type (connection_type) const;
 	size_t count_per_ip (asio::ip::address const & ip) const;
@@ -157,6 +162,21 @@ private:
 		}
 	};
 
+	struct acceptor_context
+	{
+		explicit acceptor_context (asio::io_context & io_ctx) :
+			strand{ io_ctx.get_executor () },
+			acceptor{ strand },
+			task{ strand }
+		{
+		}
+
+		nano::async::strand strand;
+		asio::ip::tcp::acceptor acceptor;
+		nano::async::task task;
+		bool distribute{ false }; // Accepted sockets are spread between IO shards
+	};
+
 private:
 	uint16_t const port;
 
@@ -165,13 +185,13 @@ private:
 
 	nano::async::strand strand;
 
-	asio::ip::tcp::acceptor acceptor;
+	// One per IO shard when listening sockets are sharded, otherwise a single acceptor on the shared IO context
+	std::vector<std::unique_ptr<acceptor_context>> acceptors;
 	asio::ip::tcp::endpoint local;
 
 	std::atomic<bool> stopped;
 	nano::condition_variable condition;
 	mutable nano::mutex mutex;
-	nano::async::task task;
 	std::thread cleanup_thread;
 
 private:
@@ -26,7 +26,8 @@ nano::transport::tcp_socket::tcp_socket (nano::node & node_a, nano::transport::s
 nano::transport::tcp_socket::tcp_socket (nano::node & node_a, boost::asio::ip::tcp::socket raw_socket_a, boost::asio::ip::tcp::endpoint remote_endpoint_a, boost::asio::ip::tcp::endpoint local_endpoint_a, nano::transport::socket_endpoint endpoint_type_a, std::size_t max_queue_size_a) :
 	send_queue{ max_queue_size_a },
 	node_w{ node_a.shared () },
-	strand{ node_a.io_ctx.get_executor () },
+	// Handlers run on the IO context owning the raw socket, which is an IO shard for sharded connections
+	strand{ static_cast<boost::asio::io_context &> (boost::asio::query (raw_socket_a.get_executor (), boost::asio::execution::context)).get_executor () },
 	raw_socket{ std::move (raw_socket_a) },
 	remote{ remote_endpoint_a },
 	local{ local_endpoint_a },
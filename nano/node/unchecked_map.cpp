@@ -1,15 +1,16 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/locks.hpp>
+#include <nano/lib/logging.hpp>
 #include <nano/lib/stats.hpp>
 #include <nano/lib/stats_enums.hpp>
 #include <nano/lib/thread_roles.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/node/unchecked_map.hpp>
 
-nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, nano::stats & stats, bool const & disable_delete) :
-	max_unchecked_blocks{ max_unchecked_blocks },
+nano::unchecked_map::unchecked_map (std::size_t max_memory, nano::stats & stats, bool const & disable_delete) :
 	stats{ stats },
-	disable_delete{ disable_delete }
+	disable_delete{ disable_delete },
+	max_memory{ max_memory }
 {
 }
 
@@ -44,33 +45,79 @@ void nano::unchecked_map::stop ()
 
 void nano::unchecked_map::put (nano::hash_or_account const & dependency, nano::unchecked_info const & info)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	nano::unchecked_key key{ dependency, info.block->hash () };
-	entries.get<tag_root> ().insert ({ key, info });
+	auto & shard = shard_for (dependency.as_block_hash ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
 
-	if (entries.size () > max_unchecked_blocks)
+	auto hash = info.block->hash ();
+	auto & dependents = shard.entries[dependency.as_block_hash ()];
+	if (std::any_of (dependents.begin (), dependents.end (), [&hash] (auto const & entry) { return entry.hash == hash; }))
 	{
-		entries.get<tag_sequenced> ().pop_front ();
+		stats.inc (nano::stat::type::unchecked, nano::stat::detail::duplicate);
+		return;
 	}
 
+	auto sequence = shard.sequence++;
+	dependents.push_back ({ hash, info, sequence, std::chrono::steady_clock::now () });
+	shard.age.emplace_back (sequence, nano::unchecked_key{ dependency, hash });
+	++shard.size;
+	shard.memory += entry_memory (info);
+
+	// Each shard receives an even part of the budget, dependencies are uniformly distributed between shards
+	while (shard.memory > max_memory / shard_count && shard.erase_oldest ())
+	{
+		stats.inc (nano::stat::type::unchecked, nano::stat::detail::erase_oldest);
+	}
+	shard.compact ();
+
 	stats.inc (nano::stat::type::unchecked, nano::stat::detail::put);
 }
 
 void nano::unchecked_map::for_each (std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	for (auto i = entries.begin (), n = entries.end (); predicate () && i != n; ++i)
+	// Actions are called without holding the shard lock, so they are free to modify the map
+	std::vector<std::pair<nano::unchecked_key, nano::unchecked_info>> items;
+	for (auto & shard : shards)
 	{
-		action (i->key, i->info);
+		items.clear ();
+		{
+			nano::lock_guard<nano::mutex> lock{ shard.mutex };
+			items.reserve (shard.size);
+			for (auto const & [dependency, dependents] : shard.entries)
+			{
+				for (auto const & entry : dependents)
+				{
+					items.emplace_back (nano::unchecked_key{ dependency, entry.hash }, entry.info);
+				}
+			}
+		}
+		for (auto const & [key, info] : items)
+		{
+			if (!predicate ())
+			{
+				return;
+			}
+			action (key, info);
+		}
 	}
 }
 
 void nano::unchecked_map::for_each (nano::hash_or_account const & dependency, std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	for (auto i = entries.template get<tag_root> ().lower_bound (nano::unchecked_key{ dependency, 0 }), n = entries.template get<tag_root> ().end (); predicate () && i != n && i->key.key () == dependency.as_block_hash (); ++i)
+	std::vector<nano::unchecked_info> items;
+	{
+		auto & shard = shard_for (dependency.as_block_hash ());
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		if (auto existing = shard.entries.find (dependency.as_block_hash ()); existing != shard.entries.end ())
+		{
+			for (auto const & entry : existing->second)
+			{
+				items.push_back (entry.info);
+			}
+		}
+	}
+	for (auto i = items.begin (), n = items.end (); predicate () && i != n; ++i)
 	{
-		action (i->key, i->info);
+		action (nano::unchecked_key{ dependency, i->block->hash () }, *i);
 	}
 }
 
@@ -85,27 +132,62 @@ std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::block_hash con
 
 bool nano::unchecked_map::exists (nano::unchecked_key const & key) const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.get<tag_root> ().count (key) != 0;
+	auto const & shard = shard_for (key.key ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto existing = shard.entries.find (key.key ());
+	return existing != shard.entries.end () && std::any_of (existing->second.begin (), existing->second.end (), [&key] (auto const & entry) { return entry.hash == key.hash; });
 }
 
 void nano::unchecked_map::del (nano::unchecked_key const & key)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	auto erased = entries.get<tag_root> ().erase (key);
-	debug_assert (erased);
+	auto & shard = shard_for (key.key ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto existing = shard.entries.find (key.key ());
+	debug_assert (existing != shard.entries.end ());
+	if (existing != shard.entries.end ())
+	{
+		auto & dependents = existing->second;
+		auto entry = std::find_if (dependents.begin (), dependents.end (), [&key] (auto const & entry) { return entry.hash == key.hash; });
+		debug_assert (entry != dependents.end ());
+		if (entry != dependents.end ())
+		{
+			shard.erase (existing, entry);
+		}
+	}
 }
 
 void nano::unchecked_map::clear ()
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	entries.clear ();
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		shard.entries.clear ();
+		shard.age.clear ();
+		shard.size = 0;
+		shard.memory = 0;
+	}
 }
 
 std::size_t nano::unchecked_map::count () const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.size ();
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		result += shard.size;
+	}
+	return result;
+}
+
+std::size_t nano::unchecked_map::memory () const
+{
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		result += shard.memory;
+	}
+	return result;
 }
 
 void nano::unchecked_map::trigger (nano::hash_or_account const & dependency)
@@ -117,14 +199,6 @@ void nano::unchecked_map::trigger (nano::hash_or_account const & dependency)
 	condition.notify_all (); // Notify run ()
 }
 
-void nano::unchecked_map::process_queries (decltype (buffer) const & back_buffer)
-{
-	for (auto const & item : back_buffer)
-	{
-		query_impl (item.hash);
-	}
-}
-
 void nano::unchecked_map::run ()
 {
 	nano::unique_lock<nano::mutex> lock{ mutex };
@@ -132,13 +206,14 @@ void nano::unchecked_map::run ()
 	{
 		if (!buffer.empty ())
 		{
-			back_buffer.swap (buffer);
-			writing_back_buffer = true;
+			decltype (buffer) queries;
+			queries.swap (buffer);
 			lock.unlock ();
-			process_queries (back_buffer);
+			for (auto const & item : queries)
+			{
+				query_impl (item.hash);
+			}
 			lock.lock ();
-			writing_back_buffer = false;
-			back_buffer.clear ();
 		}
 		else
 		{
@@ -151,28 +226,131 @@ void nano::unchecked_map::run ()
 
 void nano::unchecked_map::query_impl (nano::block_hash const & hash)
 {
-	std::deque<nano::unchecked_key> delete_queue;
-	for_each (hash, [this, &delete_queue] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-		delete_queue.push_back (key);
+	dependents satisfied_l;
+	{
+		auto & shard = shard_for (hash);
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		auto existing = shard.entries.find (hash);
+		if (existing == shard.entries.end ())
+		{
+			return;
+		}
+		if (disable_delete)
+		{
+			satisfied_l = existing->second;
+		}
+		else
+		{
+			for (auto const & entry : existing->second)
+			{
+				shard.memory -= entry_memory (entry.info);
+			}
+			shard.size -= existing->second.size ();
+			satisfied_l = std::move (existing->second);
+			shard.entries.erase (existing);
+			shard.compact ();
+		}
+	}
+
+	auto const now = std::chrono::steady_clock::now ();
+	for (auto const & entry : satisfied_l)
+	{
 		stats.inc (nano::stat::type::unchecked, nano::stat::detail::satisfied);
-		satisfied.notify (info);
-	});
-	if (!disable_delete)
+		stats.sample (nano::stat::sample::unchecked_dependency_time, nano::log::milliseconds (now - entry.arrival), { 0, 1000 * 60 * 10 /* 0-10 minutes range */ });
+		satisfied.notify (entry.info);
+	}
+}
+
+auto nano::unchecked_map::shard_for (nano::block_hash const & dependency) -> shard &
+{
+	return shards[dependency.qwords[0] % shard_count];
+}
+
+auto nano::unchecked_map::shard_for (nano::block_hash const & dependency) const -> shard const &
+{
+	return shards[dependency.qwords[0] % shard_count];
+}
+
+std::size_t nano::unchecked_map::entry_memory (nano::unchecked_info const & info)
+{
+	// Serialized block size is a close approximation of the in memory block object
+	return sizeof (entry) + sizeof (decltype (shard::age)::value_type) + nano::block::size (info.block->type ());
+}
+
+/*
+ * shard
+ */
+
+bool nano::unchecked_map::shard::erase_oldest ()
+{
+	while (!age.empty ())
+	{
+		auto [sequence, key] = age.front ();
+		age.pop_front ();
+		if (auto existing = entries.find (key.key ()); existing != entries.end ())
+		{
+			auto & dependents = existing->second;
+			auto entry = std::find_if (dependents.begin (), dependents.end (), [sequence] (auto const & entry) { return entry.sequence == sequence; });
+			if (entry != dependents.end ())
+			{
+				erase (existing, entry);
+				return true;
+			}
+		}
+		// Already removed, skip
+	}
+	return false;
+}
+
+void nano::unchecked_map::shard::erase (std::unordered_map<nano::block_hash, dependents>::iterator existing, dependents::iterator entry)
+{
+	memory -= entry_memory (entry->info);
+	--size;
+	existing->second.erase (entry);
+	if (existing->second.empty ())
+	{
+		entries.erase (existing);
+	}
+}
+
+void nano::unchecked_map::shard::compact ()
+{
+	// Rebuild the age queue once stale keys outnumber live entries
+	if (age.size () <= 2 * size + 1024)
+	{
+		return;
+	}
+	decltype (age) live;
+	for (auto const & [sequence, key] : age)
 	{
-		for (auto const & key : delete_queue)
+		if (auto existing = entries.find (key.key ()); existing != entries.end ())
 		{
-			del (key);
+			if (std::any_of (existing->second.begin (), existing->second.end (), [sequence] (auto const & entry) { return entry.sequence == sequence; }))
+			{
+				live.emplace_back (sequence, key);
+			}
 		}
 	}
+	age.swap (live);
 }
 
 std::unique_ptr<nano::container_info_component> nano::unchecked_map::collect_container_info (const std::string & name)
 {
 	auto composite = std::make_unique<container_info_composite> (name);
+	std::size_t entries_count = 0;
+	std::size_t dependencies_count = 0;
+	std::size_t age_count = 0;
+	for (auto const & shard : shards)
 	{
-		std::lock_guard guard{ entries_mutex };
-		composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", entries.size (), sizeof (decltype (entries)::value_type) }));
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		entries_count += shard.size;
+		dependencies_count += shard.entries.size ();
+		age_count += shard.age.size ();
 	}
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", entries_count, sizeof (entry) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "dependencies", dependencies_count, sizeof (decltype (shard::entries)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "age", age_count, sizeof (decltype (shard::age)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "memory", memory (), 1 }));
 	{
 		nano::lock_guard<nano::mutex> lock{ mutex };
 		composite->add_component (std::make_unique<container_info_leaf> (container_info{ "queries", buffer.size (), sizeof (decltype (buffer)::value_type) }));
@@ -5,24 +5,27 @@
 #include <nano/lib/observer_set.hpp>
 #include <nano/secure/common.hpp>
 
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/random_access_index.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <boost/container/small_vector.hpp>
 
+#include <array>
+#include <chrono>
+#include <deque>
 #include <thread>
-
-namespace mi = boost::multi_index;
+#include <unordered_map>
 
 namespace nano
 {
 class stats;
 
+/**
+ * Holds blocks whose dependency (previous block, source block or epoch account) is not yet in the ledger.
+ * Entries are grouped by dependency in a hash map split into independently locked shards, so a satisfied dependency releases all its dependents with a single lookup.
+ * Memory use is bounded by a byte budget, once exceeded the oldest entries are evicted.
+ */
 class unchecked_map
 {
 public:
-	unchecked_map (unsigned const max_unchecked_blocks, nano::stats &, bool const & do_delete);
+	unchecked_map (std::size_t max_memory, nano::stats &, bool const & do_delete);
 	~unchecked_map ();
 
 	void start ();
@@ -38,6 +41,8 @@ public:
 	void del (nano::unchecked_key const & key);
 	void clear ();
 	std::size_t count () const;
+	/** Approximate memory held by entries, in bytes */
+	std::size_t memory () const;
 
 	/**
 	 * Trigger requested dependencies
@@ -57,38 +62,49 @@ private: // Dependencies
 private:
 	bool const & disable_delete;
 	std::deque<nano::hash_or_account> buffer;
-	std::deque<nano::hash_or_account> back_buffer;
-	bool writing_back_buffer{ false };
 
 	bool stopped{ false };
 	nano::condition_variable condition;
 	nano::mutex mutex;
 	std::thread thread;
 
-	unsigned const max_unchecked_blocks;
-
-	void process_queries (decltype (buffer) const & back_buffer);
+	std::size_t const max_memory;
 
 private:
 	struct entry
 	{
-		nano::unchecked_key key;
+		nano::block_hash hash;
 		nano::unchecked_info info;
+		uint64_t sequence; // Insertion order, identifies the entry in the age queue
+		std::chrono::steady_clock::time_point arrival;
 	};
 
-	// clang-format off
-	class tag_sequenced {};
-	class tag_root {};
+	// Most dependencies have a single dependent block
+	using dependents = boost::container::small_vector<entry, 1>;
+
+	class shard
+	{
+	public:
+		std::unordered_map<nano::block_hash, dependents> entries;
+		// Keys in insertion order, entries removed by other means are skipped lazily
+		std::deque<std::pair<uint64_t, nano::unchecked_key>> age;
+		std::size_t size{ 0 };
+		std::size_t memory{ 0 };
+		uint64_t sequence{ 0 };
+		mutable nano::mutex mutex;
+
+		/** @return false if there is nothing left to erase */
+		bool erase_oldest ();
+		void erase (std::unordered_map<nano::block_hash, dependents>::iterator, dependents::iterator);
+		void compact ();
+	};
 
-	using ordered_unchecked = boost::multi_index_container<entry,
-		mi::indexed_by<
-			mi::sequenced<mi::tag<tag_sequenced>>,
-			mi::ordered_unique<mi::tag<tag_root>,
-				mi::member<entry, nano::unchecked_key, &entry::key>>>>;
-	// clang-format on
-	ordered_unchecked entries;
+	static std::size_t constexpr shard_count{ 16 };
+	std::array<shard, shard_count> shards;
 
-	mutable std::recursive_mutex entries_mutex;
+	shard & shard_for (nano::block_hash const & dependency);
+	shard const & shard_for (nano::block_hash const & dependency) const;
+	static std::size_t entry_memory (nano::unchecked_info const &);
 
 public: // Container info
 	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name);
@@ -4,10 +4,10 @@
 #include <nano/node/vote_cache.hpp>
 #include <nano/node/vote_router.hpp>
 
-#include <ranges>
+#include <algorithm>
 
 /*
- * entvote_cache_entryry
+ * vote_cache_entry
  */
 
 nano::vote_cache_entry::vote_cache_entry (const nano::block_hash & hash) :
@@ -32,74 +32,91 @@ bool nano::vote_cache_entry::vote_impl (std::shared_ptr<nano::vote> const & vote
 {
 	auto const representative = vote->account;
 
-	if (auto existing = voters.find (representative); existing != voters.end ())
+	if (auto existing = find_voter (representative); existing < representatives.size ())
 	{
 		// We already have a vote from this rep
 		// Update timestamp if newer but tally remains unchanged as we already counted this rep weight
 		// It is not essential to keep tally up to date if rep voting weight changes, elections do tally calculations independently, so in the worst case scenario only our queue ordering will be a bit off
-		if (vote->timestamp () > existing->vote->timestamp ())
+		if (vote->timestamp () > votes_m[existing]->timestamp ())
 		{
-			bool was_final = existing->vote->is_final ();
-			voters.modify (existing, [&vote, &rep_weight] (auto & existing) {
-				existing.vote = vote;
-				existing.weight = rep_weight;
-			});
+			bool was_final = votes_m[existing]->is_final ();
+			votes_m[existing] = vote;
+			weights[existing] = rep_weight;
 			return !was_final && vote->is_final (); // Tally changed only if the vote became final
 		}
 	}
 	else
 	{
-		auto should_add = [&, this] () {
-			if (voters.size () < max_voters)
-			{
-				return true;
-			}
-			else
-			{
-				release_assert (!voters.empty ());
-				auto const & min_weight = voters.get<tag_weight> ().begin ()->weight;
-				return rep_weight > min_weight;
-			}
-		};
-
 		// Vote from a new representative, add it to the list and update tally
-		if (should_add ())
+		if (representatives.size () < max_voters)
 		{
-			voters.insert ({ representative, rep_weight, vote });
-
-			// If we have reached the maximum number of voters, remove the lowest weight voter
-			if (voters.size () >= max_voters)
-			{
-				release_assert (!voters.empty ());
-				voters.get<tag_weight> ().erase (voters.get<tag_weight> ().begin ());
-			}
+			representatives.push_back (representative);
+			weights.push_back (rep_weight);
+			votes_m.push_back (vote);
+			return true;
+		}
 
+		// If we have reached the maximum number of voters, replace the lowest weight voter
+		release_assert (!representatives.empty ());
+		auto const min = find_min_weight ();
+		if (rep_weight > weights[min])
+		{
+			representatives[min] = representative;
+			weights[min] = rep_weight;
+			votes_m[min] = vote;
 			return true;
 		}
 	}
 	return false; // Tally unchanged
 }
 
+std::size_t nano::vote_cache_entry::find_voter (nano::account const & representative) const
+{
+	auto it = std::find (representatives.begin (), representatives.end (), representative);
+	return static_cast<std::size_t> (std::distance (representatives.begin (), it));
+}
+
+std::size_t nano::vote_cache_entry::find_min_weight () const
+{
+	auto it = std::min_element (weights.begin (), weights.end ());
+	return static_cast<std::size_t> (std::distance (weights.begin (), it));
+}
+
 std::size_t nano::vote_cache_entry::size () const
 {
-	return voters.size ();
+	return representatives.size ();
+}
+
+std::size_t nano::vote_cache_entry::capacity () const
+{
+	return representatives.capacity ();
+}
+
+void nano::vote_cache_entry::reset (nano::block_hash const & hash)
+{
+	representatives.clear ();
+	weights.clear ();
+	votes_m.clear ();
+	hash_m = hash;
+	last_vote_m = {};
+	tally_m = 0;
+	final_tally_m = 0;
 }
 
 auto nano::vote_cache_entry::calculate_tally () const -> std::pair<nano::uint128_t, nano::uint128_t>
 {
 	nano::uint128_t tally{ 0 }, final_tally{ 0 };
-	for (auto const & voter : voters)
+	for (std::size_t i = 0; i < weights.size (); ++i)
 	{
-		tally += voter.weight;
-		final_tally += voter.vote->is_final () ? voter.weight : 0;
+		tally += weights[i];
+		final_tally += votes_m[i]->is_final () ? weights[i] : 0;
 	}
 	return { tally, final_tally };
 }
 
 std::vector<std::shared_ptr<nano::vote>> nano::vote_cache_entry::votes () const
 {
-	auto r = voters | std::views::transform ([] (auto const & item) { return item.vote; });
-	return { r.begin (), r.end () };
+	return votes_m;
 }
 
 /*
@@ -110,12 +127,13 @@ nano::vote_cache::vote_cache (vote_cache_config const & config_a, nano::stats &
 	config{ config_a },
 	stats{ stats_a }
 {
+	rehash (1024);
 }
 
 void nano::vote_cache::insert (std::shared_ptr<nano::vote> const & vote, std::unordered_map<nano::block_hash, nano::vote_code> const & results)
 {
 	// Results map should be empty or have the same hashes as the vote
-	debug_assert (results.empty () || std::all_of (vote->hashes.begin (), vote->hashes.end (), [&results] (auto const & hash) { return results.find (hash) != results.end (); }));
+	debug_assert (results.empty () || std::all_of (vote->hashes ().begin (), vote->hashes ().end (), [&results] (auto const & hash) { return results.find (hash) != results.end (); }));
 
 	auto const representative = vote->account;
 	auto const rep_weight = rep_weight_query (representative);
@@ -130,7 +148,7 @@ void nano::vote_cache::insert (std::shared_ptr<nano::vote> const & vote, std::un
 	// If results map is empty, insert all hashes (meant for testing)
 	if (results.empty ())
 	{
-		for (auto const & hash : vote->hashes)
+		for (auto const & hash : vote->hashes ())
 		{
 			insert_impl (vote, hash, rep_weight);
 		}
@@ -150,28 +168,169 @@ void nano::vote_cache::insert (std::shared_ptr<nano::vote> const & vote, std::un
 void nano::vote_cache::insert_impl (std::shared_ptr<nano::vote> const & vote, nano::block_hash const & hash, nano::uint128_t const & rep_weight)
 {
 	debug_assert (!mutex.try_lock ());
-	debug_assert (std::any_of (vote->hashes.begin (), vote->hashes.end (), [&hash] (auto const & vote_hash) { return vote_hash == hash; }));
+	debug_assert (std::any_of (vote->hashes ().begin (), vote->hashes ().end (), [&hash] (auto const & vote_hash) { return vote_hash == hash; }));
 
-	if (auto existing = cache.find (hash); existing != cache.end ())
+	if (auto bucket_index = find_bucket (hash); buckets[bucket_index].index != null_index)
 	{
 		stats.inc (nano::stat::type::vote_cache, nano::stat::detail::update);
 
-		cache.modify (existing, [this, &vote, &rep_weight] (entry & ent) {
-			ent.vote (vote, rep_weight, config.max_voters);
-		});
+		slots[buckets[bucket_index].index].value.vote (vote, rep_weight, config.max_voters);
 	}
 	else
 	{
 		stats.inc (nano::stat::type::vote_cache, nano::stat::detail::insert);
 
-		entry cache_entry{ hash };
-		cache_entry.vote (vote, rep_weight, config.max_voters);
-		cache.insert (cache_entry);
-
 		// Remove the oldest entry if we have reached the capacity limit
-		if (cache.size () > config.max_size)
+		if (count >= config.max_size)
+		{
+			evict_oldest ();
+		}
+
+		// Keep load factor at or below 50%, which keeps probe sequences short
+		if ((count + 1) * 2 > buckets.size ())
+		{
+			rehash (buckets.size () * 2);
+		}
+
+		auto index = allocate (hash);
+		slots[index].value.vote (vote, rep_weight, config.max_voters);
+
+		bucket_index = find_bucket (hash);
+		debug_assert (buckets[bucket_index].index == null_index);
+		buckets[bucket_index] = { hash, index };
+	}
+}
+
+auto nano::vote_cache::allocate (nano::block_hash const & hash) -> index_t
+{
+	index_t index;
+	if (!free_slots.empty ())
+	{
+		index = free_slots.back ();
+		free_slots.pop_back ();
+	}
+	else
+	{
+		release_assert (slots.size () < null_index);
+		index = static_cast<index_t> (slots.size ());
+		slots.emplace_back ();
+	}
+
+	auto & slot = slots[index];
+	debug_assert (!slot.used);
+	slot.value.reset (hash);
+	slot.used = true;
+
+	// Link as the newest entry
+	slot.prev = newest;
+	slot.next = null_index;
+	if (newest != null_index)
+	{
+		slots[newest].next = index;
+	}
+	newest = index;
+	if (oldest == null_index)
+	{
+		oldest = index;
+	}
+
+	++count;
+	return index;
+}
+
+void nano::vote_cache::release (index_t index)
+{
+	auto & slot = slots[index];
+	debug_assert (slot.used);
+
+	// Unlink from insertion order list
+	if (slot.prev != null_index)
+	{
+		slots[slot.prev].next = slot.next;
+	}
+	else
+	{
+		oldest = slot.next;
+	}
+	if (slot.next != null_index)
+	{
+		slots[slot.next].prev = slot.prev;
+	}
+	else
+	{
+		newest = slot.prev;
+	}
+
+	// Drop vote references now, but keep the allocated voter capacity for reuse
+	slot.value.reset ({});
+	slot.prev = null_index;
+	slot.next = null_index;
+	slot.used = false;
+	free_slots.push_back (index);
+
+	debug_assert (count > 0);
+	--count;
+}
+
+void nano::vote_cache::evict_oldest ()
+{
+	debug_assert (oldest != null_index);
+	auto bucket_index = find_bucket (slots[oldest].value.hash ());
+	debug_assert (buckets[bucket_index].index == oldest);
+	erase_bucket (bucket_index);
+}
+
+std::size_t nano::vote_cache::home_bucket (nano::block_hash const & hash) const
+{
+	// Block hashes are uniformly distributed, so the low bits can be used directly
+	return static_cast<std::size_t> (hash.qwords[0]) & (buckets.size () - 1);
+}
+
+std::size_t nano::vote_cache::find_bucket (nano::block_hash const & hash) const
+{
+	auto const mask = buckets.size () - 1;
+	for (auto i = home_bucket (hash);; i = (i + 1) & mask)
+	{
+		auto const & bucket = buckets[i];
+		if (bucket.index == null_index || bucket.hash == hash)
 		{
-			cache.get<tag_sequenced> ().pop_front ();
+			return i;
+		}
+	}
+}
+
+void nano::vote_cache::erase_bucket (std::size_t i)
+{
+	debug_assert (buckets[i].index != null_index);
+	release (buckets[i].index);
+	buckets[i].index = null_index;
+
+	// Backward shift deletion, moves following entries of the probe sequence into the gap so lookups do not need tombstones
+	auto const mask = buckets.size () - 1;
+	for (auto j = (i + 1) & mask; buckets[j].index != null_index; j = (j + 1) & mask)
+	{
+		auto const home = home_bucket (buckets[j].hash);
+		// Entry at `j` can be moved to `i` only if its home bucket is not cyclically within (i, j]
+		bool const movable = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+		if (movable)
+		{
+			buckets[i] = buckets[j];
+			buckets[j].index = null_index;
+			i = j;
+		}
+	}
+}
+
+void nano::vote_cache::rehash (std::size_t bucket_count)
+{
+	debug_assert ((bucket_count & (bucket_count - 1)) == 0); // Power of two
+	auto previous = std::move (buckets);
+	buckets.assign (bucket_count, bucket{});
+	for (auto const & bucket : previous)
+	{
+		if (bucket.index != null_index)
+		{
+			buckets[find_bucket (bucket.hash)] = bucket;
 		}
 	}
 }
@@ -179,23 +338,22 @@ void nano::vote_cache::insert_impl (std::shared_ptr<nano::vote> const & vote, na
 bool nano::vote_cache::empty () const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
-	return cache.empty ();
+	return count == 0;
 }
 
 std::size_t nano::vote_cache::size () const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
-	return cache.size ();
+	return count;
 }
 
 std::vector<std::shared_ptr<nano::vote>> nano::vote_cache::find (const nano::block_hash & hash) const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
 
-	auto & cache_by_hash = cache.get<tag_hash> ();
-	if (auto existing = cache_by_hash.find (hash); existing != cache_by_hash.end ())
+	if (auto bucket_index = find_bucket (hash); buckets[bucket_index].index != null_index)
 	{
-		return existing->votes ();
+		return slots[buckets[bucket_index].index].value.votes ();
 	}
 	return {};
 }
@@ -205,10 +363,9 @@ bool nano::vote_cache::erase (const nano::block_hash & hash)
 	nano::lock_guard<nano::mutex> lock{ mutex };
 
 	bool result = false;
-	auto & cache_by_hash = cache.get<tag_hash> ();
-	if (auto existing = cache_by_hash.find (hash); existing != cache_by_hash.end ())
+	if (auto bucket_index = find_bucket (hash); buckets[bucket_index].index != null_index)
 	{
-		cache_by_hash.erase (existing);
+		erase_bucket (bucket_index);
 		result = true;
 	}
 	return result;
@@ -217,7 +374,15 @@ bool nano::vote_cache::erase (const nano::block_hash & hash)
 void nano::vote_cache::clear ()
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
-	cache.clear ();
+	slots.clear ();
+	free_slots.clear ();
+	for (auto & bucket : buckets)
+	{
+		bucket.index = null_index;
+	}
+	oldest = null_index;
+	newest = null_index;
+	count = 0;
 }
 
 std::deque<nano::vote_cache::top_entry> nano::vote_cache::top (const nano::uint128_t & min_tally)
@@ -233,14 +398,12 @@ std::deque<nano::vote_cache::top_entry> nano::vote_cache::top (const nano::uint1
 			cleanup ();
 		}
 
-		for (auto & entry : cache.get<tag_tally> ())
+		for (auto const & slot : slots)
 		{
-			auto tally = entry.tally ();
-			if (tally < min_tally)
+			if (slot.used && slot.value.tally () >= min_tally)
 			{
-				break;
+				results.push_back ({ slot.value.hash (), slot.value.tally (), slot.value.final_tally () });
 			}
-			results.push_back ({ entry.hash (), tally, entry.final_tally () });
 		}
 	}
 
@@ -267,17 +430,33 @@ void nano::vote_cache::cleanup ()
 
 	auto const cutoff = std::chrono::steady_clock::now () - config.age_cutoff;
 
-	erase_if (cache, [cutoff] (auto const & entry) {
-		return entry.last_vote () < cutoff;
-	});
+	for (auto i = oldest; i != null_index;)
+	{
+		auto const & slot = slots[i];
+		auto const next = slot.next;
+		if (slot.value.last_vote () < cutoff)
+		{
+			erase_bucket (find_bucket (slot.value.hash ()));
+		}
+		i = next;
+	}
 }
 
 std::unique_ptr<nano::container_info_component> nano::vote_cache::collect_container_info (const std::string & name) const
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
 
+	std::size_t voters_capacity = 0;
+	for (auto const & slot : slots)
+	{
+		voters_capacity += slot.value.capacity ();
+	}
+
 	auto composite = std::make_unique<container_info_composite> (name);
-	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "cache", cache.size (), sizeof (ordered_cache::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "cache", count, sizeof (slot) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "free_slots", free_slots.size (), sizeof (slot) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "buckets", buckets.size (), sizeof (bucket) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "voters", voters_capacity, entry::voter_size }));
 	return composite;
 }
 
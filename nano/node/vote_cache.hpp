@@ -6,21 +6,14 @@
 #include <nano/lib/utility.hpp>
 #include <nano/secure/common.hpp>
 
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/mem_fun.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index_container.hpp>
-
+#include <deque>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <unordered_set>
 #include <vector>
 
-namespace mi = boost::multi_index;
-
 namespace nano
 {
 class node;
@@ -47,19 +40,17 @@ public:
 
 /**
  * Stores votes associated with a single block hash
+ * Voters are kept in flat, parallel arrays (representative, weight, vote) that are scanned linearly, which for the small number of voters per block is faster than any node based index.
+ * Entries are recycled by `vote_cache`, so the arrays keep their capacity and steady state inserts do not allocate.
  */
 class vote_cache_entry final
 {
-private:
-	struct voter_entry
-	{
-		nano::account representative;
-		nano::uint128_t weight;
-		std::shared_ptr<nano::vote> vote;
-	};
+public:
+	/// Approximate memory used by a single voter
+	static std::size_t constexpr voter_size = sizeof (nano::account) + sizeof (nano::uint128_t) + sizeof (std::shared_ptr<nano::vote>);
 
 public:
-	explicit vote_cache_entry (nano::block_hash const & hash);
+	explicit vote_cache_entry (nano::block_hash const & hash = {});
 
 	/**
 	 * Adds a vote into a list, checks for duplicates and updates timestamp if new one is greater
@@ -70,6 +61,12 @@ public:
 	std::size_t size () const;
 	std::vector<std::shared_ptr<nano::vote>> votes () const;
 
+	/**
+	 * Clears all voters and assigns a new hash, allocated capacity is retained
+	 */
+	void reset (nano::block_hash const & hash);
+	std::size_t capacity () const;
+
 public: // Keep accessors inlined
 	nano::block_hash hash () const
 	{
@@ -91,24 +88,15 @@ public: // Keep accessors inlined
 private:
 	bool vote_impl (std::shared_ptr<nano::vote> const & vote, nano::uint128_t const & rep_weight, std::size_t max_voters);
 	std::pair<nano::uint128_t, nano::uint128_t> calculate_tally () const; // <tally, final_tally>
+	std::size_t find_voter (nano::account const & representative) const;
+	std::size_t find_min_weight () const;
 
-	// clang-format off
-	class tag_representative {};
-	class tag_weight {};
-	// clang-format on
-
-	// clang-format off
-	using ordered_voters = boost::multi_index_container<voter_entry,
-	mi::indexed_by<
-		mi::hashed_unique<mi::tag<tag_representative>,
-			mi::member<voter_entry, nano::account, &voter_entry::representative>>,
-		mi::ordered_non_unique<mi::tag<tag_weight>,
-			mi::member<voter_entry, nano::uint128_t, &voter_entry::weight>>
-	>>;
-	// clang-format on
-	ordered_voters voters;
-
-	nano::block_hash const hash_m;
+	// Structure of arrays, index `i` in each array refers to the same voter
+	std::vector<nano::account> representatives;
+	std::vector<nano::uint128_t> weights;
+	std::vector<std::shared_ptr<nano::vote>> votes_m;
+
+	nano::block_hash hash_m;
 	std::chrono::steady_clock::time_point last_vote_m{};
 	nano::uint128_t tally_m{ 0 };
 	nano::uint128_t final_tally_m{ 0 };
@@ -176,23 +164,45 @@ private:
 	void insert_impl (std::shared_ptr<nano::vote> const &, nano::block_hash const & hash, nano::uint128_t const & rep_weight);
 	void cleanup ();
 
-	// clang-format off
-	class tag_sequenced {};
-	class tag_hash {};
-	class tag_tally {};
-	// clang-format on
-
-	// clang-format off
-	using ordered_cache = boost::multi_index_container<entry,
-	mi::indexed_by<
-		mi::hashed_unique<mi::tag<tag_hash>,
-			mi::const_mem_fun<entry, nano::block_hash, &entry::hash>>,
-		mi::sequenced<mi::tag<tag_sequenced>>,
-		mi::ordered_non_unique<mi::tag<tag_tally>,
-			mi::const_mem_fun<entry, nano::uint128_t, &entry::tally>, std::greater<>> // DESC
-	>>;
-	// clang-format on
-	ordered_cache cache;
+private: // Storage
+	using index_t = uint32_t;
+	static index_t constexpr null_index = std::numeric_limits<index_t>::max ();
+
+	/**
+	 * Entries live in a slot array and are linked into an intrusive list in insertion order, used for evicting the oldest entry
+	 * Unused slots are kept on a free list and reused together with their allocated voter capacity
+	 */
+	struct slot
+	{
+		entry value;
+		index_t prev{ null_index };
+		index_t next{ null_index };
+		bool used{ false };
+	};
+
+	/**
+	 * Open addressing hash table with linear probing, mapping block hash to slot index
+	 */
+	struct bucket
+	{
+		nano::block_hash hash;
+		index_t index{ null_index };
+	};
+
+	index_t allocate (nano::block_hash const & hash);
+	void release (index_t);
+	void evict_oldest ();
+	std::size_t home_bucket (nano::block_hash const & hash) const;
+	std::size_t find_bucket (nano::block_hash const & hash) const; // Returns either the matching or the first empty bucket
+	void erase_bucket (std::size_t);
+	void rehash (std::size_t bucket_count);
+
+	std::vector<slot> slots;
+	std::vector<index_t> free_slots;
+	std::vector<bucket> buckets;
+	index_t oldest{ null_index };
+	index_t newest{ null_index };
+	std::size_t count{ 0 };
 
 	mutable nano::mutex mutex;
 	nano::interval cleanup_interval;
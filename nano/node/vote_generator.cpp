@@ -1,4 +1,5 @@
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/object_pool.hpp>
 #include <nano/lib/stats.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/node/local_vote_history.hpp>
@@ -29,7 +30,9 @@ nano::vote_generator::vote_generator (nano::node_config const & config_a, nano::
 	logger (logger_a),
 	is_final (is_final_a),
 	vote_generation_queue{ stats, nano::stat::type::vote_generator, nano::thread_role::name::vote_generator_queue, /* single threaded */ 1, /* max queue size */ 1024 * 32, /* max batch size */ 256 },
-	inproc_channel{ std::make_shared<nano::transport::inproc::channel> (node, node) }
+	inproc_channel{ std::make_shared<nano::transport::inproc::channel> (node, node) },
+	signers{ std::max (config_a.vote_generator_threads, 1u), nano::thread_role::name::vote_generator_signing },
+	max_signing{ 4 * signers.get_num_threads () }
 {
 	vote_generation_queue.process_batch = [this] (auto & batch) {
 		process_batch (batch);
@@ -94,6 +97,12 @@ void nano::vote_generator::stop ()
 	{
 		thread.join ();
 	}
+
+	{
+		nano::lock_guard<nano::mutex> guard{ signing_mutex };
+	}
+	signing_condition.notify_all ();
+	signers.stop ();
 }
 
 void nano::vote_generator::add (const root & root, const block_hash & hash)
@@ -246,7 +255,7 @@ void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, reque
 		if (!hashes.empty ())
 		{
 			stats.add (nano::stat::type::requests, nano::stat::detail::requests_generated_hashes, stat::dir::in, hashes.size ());
-			vote (hashes, roots, [this, &channel = request_a.second] (std::shared_ptr<nano::vote> const & vote_a) {
+			vote (hashes, roots, [this, channel = request_a.second] (std::shared_ptr<nano::vote> const & vote_a) mutable {
 				this->reply_action (vote_a, channel);
 				this->stats.inc (nano::stat::type::requests, nano::stat::detail::requests_generated_votes, stat::dir::in);
 			});
@@ -259,20 +268,85 @@ void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, reque
 void nano::vote_generator::vote (std::vector<nano::block_hash> const & hashes_a, std::vector<nano::root> const & roots_a, std::function<void (std::shared_ptr<nano::vote> const &)> const & action_a)
 {
 	debug_assert (hashes_a.size () == roots_a.size ());
-	std::vector<std::shared_ptr<nano::vote>> votes_l;
-	wallets.foreach_representative ([this, &hashes_a, &votes_l] (nano::public_key const & pub_a, nano::raw_key const & prv_a) {
-		auto timestamp = this->is_final ? nano::vote::timestamp_max : nano::milliseconds_since_epoch ();
-		uint8_t duration = this->is_final ? nano::vote::duration_max : /*8192ms*/ 0x9;
-		votes_l.emplace_back (std::make_shared<nano::vote> (pub_a, prv_a, timestamp, duration, hashes_a));
+
+	// Spacing is flagged before signing so that batches built next by this thread already observe it
+	for (std::size_t i (0), n (hashes_a.size ()); i != n; ++i)
+	{
+		spacing.flag (roots_a[i], hashes_a[i]);
+	}
+
+	auto job = std::make_shared<signing_job> ();
+	job->hashes = hashes_a;
+	job->roots = roots_a;
+	job->action = action_a;
+	// Timestamps are taken here so they increase along with the submission order
+	job->timestamp = is_final ? nano::vote::timestamp_max : nano::milliseconds_since_epoch ();
+
+	uint64_t sequence;
+	{
+		nano::unique_lock<nano::mutex> lock{ signing_mutex };
+		signing_condition.wait (lock, [this] () { return stopped || signing < max_signing; });
+		if (stopped)
+		{
+			return;
+		}
+		sequence = next_sequence++;
+		++signing;
+	}
+
+	signers.push_task ([this, sequence, job] () {
+		sign (sequence, job);
+	});
+}
+
+void nano::vote_generator::sign (uint64_t sequence, std::shared_ptr<signing_job> job)
+{
+	uint8_t duration = is_final ? nano::vote::duration_max : /*8192ms*/ 0x9;
+	wallets.foreach_representative ([&job, duration] (nano::public_key const & pub_a, nano::raw_key const & prv_a) {
+		job->votes.emplace_back (nano::make_pooled<nano::vote> (pub_a, prv_a, job->timestamp, duration, job->hashes));
 	});
-	for (auto const & vote_l : votes_l)
+
+	nano::unique_lock<nano::mutex> lock{ completion_mutex };
+	signed_jobs.emplace (sequence, std::move (job));
+	// Batches are completed by one thread at a time, the current owner picks up this batch once all earlier batches are done
+	if (completing)
+	{
+		return;
+	}
+	completing = true;
+	while (true)
 	{
-		for (std::size_t i (0), n (hashes_a.size ()); i != n; ++i)
+		std::vector<std::shared_ptr<signing_job>> ready;
+		while (!signed_jobs.empty () && signed_jobs.begin ()->first == next_completion)
+		{
+			ready.push_back (std::move (signed_jobs.begin ()->second));
+			signed_jobs.erase (signed_jobs.begin ());
+			++next_completion;
+		}
+		if (ready.empty ())
+		{
+			completing = false;
+			break;
+		}
+		// Replies and broadcasts run outside of the lock so other threads can keep handing in signed batches
+		lock.unlock ();
+		for (auto const & ready_l : ready)
+		{
+			for (auto const & vote_l : ready_l->votes)
+			{
+				for (std::size_t i (0), n (ready_l->hashes.size ()); i != n; ++i)
+				{
+					history.add (ready_l->roots[i], ready_l->hashes[i], vote_l);
+				}
+				ready_l->action (vote_l);
+			}
+		}
 		{
-			history.add (roots_a[i], hashes_a[i], vote_l);
-			spacing.flag (roots_a[i], hashes_a[i]);
+			nano::lock_guard<nano::mutex> guard{ signing_mutex };
+			signing -= ready.size ();
 		}
-		action_a (vote_l);
+		signing_condition.notify_all ();
+		lock.lock ();
 	}
 }
 
@@ -329,5 +403,6 @@ std::unique_ptr<nano::container_info_component> nano::vote_generator::collect_co
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "candidates", candidates_count, sizeof_candidate_element }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "requests", requests_count, sizeof_request_element }));
 	composite->add_component (vote_generation_queue.collect_container_info ("vote_generation_queue"));
+	composite->add_component (signers.collect_container_info ("signers"));
 	return composite;
 }
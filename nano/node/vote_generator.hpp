@@ -4,6 +4,7 @@
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/processing_queue.hpp>
+#include <nano/lib/thread_pool.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/node/wallet.hpp>
 #include <nano/secure/common.hpp>
@@ -16,6 +17,7 @@
 
 #include <condition_variable>
 #include <deque>
+#include <map>
 #include <thread>
 #include <variant>
 
@@ -74,9 +76,20 @@ private:
 	void run ();
 	void broadcast (nano::unique_lock<nano::mutex> &);
 	void reply (nano::unique_lock<nano::mutex> &, request_t &&);
+	/** Hands a batch over to the signing threads, `action` is called for each signed vote in the order batches were submitted */
 	void vote (std::vector<nano::block_hash> const &, std::vector<nano::root> const &, std::function<void (std::shared_ptr<nano::vote> const &)> const &);
 	void broadcast_action (std::shared_ptr<nano::vote> const &) const;
 	void process_batch (std::deque<queue_entry_t> & batch);
+
+	struct signing_job
+	{
+		std::vector<nano::block_hash> hashes;
+		std::vector<nano::root> roots;
+		std::function<void (std::shared_ptr<nano::vote> const &)> action;
+		uint64_t timestamp;
+		std::vector<std::shared_ptr<nano::vote>> votes;
+	};
+	void sign (uint64_t sequence, std::shared_ptr<signing_job>);
 	bool should_vote (transaction_variant_t const &, nano::root const &, nano::block_hash const &) const;
 
 private:
@@ -108,5 +121,21 @@ private:
 	std::atomic<bool> stopped{ false };
 	std::thread thread;
 	std::shared_ptr<nano::transport::channel> inproc_channel;
+
+private: // Signing
+	nano::thread_pool signers;
+	std::size_t const max_signing;
+	// Assigns sequence numbers to submitted batches and bounds the number of batches being signed
+	nano::mutex signing_mutex;
+	nano::condition_variable signing_condition;
+	uint64_t next_sequence{ 0 };
+	std::size_t signing{ 0 };
+	// Signed batches waiting for all earlier batches to finish, so history always ends up with the latest vote for a root
+	nano::mutex completion_mutex;
+	std::map<uint64_t, std::shared_ptr<signing_job>> signed_jobs;
+	uint64_t next_completion{ 0 };
+	bool completing{ false }; // Set while a thread is recording and sending completed batches
+
+	friend class vote_generator_ordering_Test;
 };
 }
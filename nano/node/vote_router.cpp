@@ -59,7 +59,7 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 {
 	debug_assert (!vote->validate ()); // false => valid vote
 	// If present, filter should be set to one of the hashes in the vote
-	debug_assert (filter.is_zero () || std::any_of (vote->hashes.begin (), vote->hashes.end (), [&filter] (auto const & hash) {
+	debug_assert (filter.is_zero () || std::any_of (vote->hashes ().begin (), vote->hashes ().end (), [&filter] (auto const & hash) {
 		return hash == filter;
 	}));
 
@@ -67,7 +67,7 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 	std::unordered_map<nano::block_hash, std::shared_ptr<nano::election>> process;
 	{
 		std::shared_lock lock{ mutex };
-		for (auto const & hash : vote->hashes)
+		for (auto const & hash : vote->hashes ())
 		{
 			// Ignore votes for other hashes if a filter is set
 			if (!filter.is_zero () && hash != filter)
@@ -114,7 +114,7 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 	}
 
 	// All hashes should have their result set
-	debug_assert (!filter.is_zero () || std::all_of (vote->hashes.begin (), vote->hashes.end (), [&results] (auto const & hash) {
+	debug_assert (!filter.is_zero () || std::all_of (vote->hashes ().begin (), vote->hashes ().end (), [&results] (auto const & hash) {
 		return results.find (hash) != results.end ();
 	}));
 
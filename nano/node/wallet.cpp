@@ -716,10 +716,19 @@ bool nano::wallet::enter_password (store::transaction const & transaction_a, std
 	{
 		wallets.node.logger.warn (nano::log::type::wallet, "Invalid password, wallet locked");
 	}
+	wallets.invalidate_signing_keys ();
 	lock_observer (result, password_a.empty ());
 	return result;
 }
 
+void nano::wallet::lock ()
+{
+	nano::raw_key empty;
+	empty.clear ();
+	store.password.value_set (empty);
+	wallets.invalidate_signing_keys ();
+}
+
 nano::public_key nano::wallet::deterministic_insert (store::transaction const & transaction_a, bool generate_work_a)
 {
 	nano::public_key key{};
@@ -733,8 +742,10 @@ nano::public_key nano::wallet::deterministic_insert (store::transaction const &
 		auto half_principal_weight (wallets.node.minimum_principal_weight () / 2);
 		if (wallets.check_rep (key, half_principal_weight))
 		{
-			nano::lock_guard<nano::mutex> lock{ representatives_mutex };
-			representatives.insert (key);
+			{
+				nano::lock_guard<nano::mutex> lock{ representatives_mutex };
+				representatives.insert (key);
+			}
 		}
 	}
 	return key;
@@ -757,8 +768,13 @@ nano::public_key nano::wallet::deterministic_insert (uint32_t const index, bool
 
 nano::public_key nano::wallet::deterministic_insert (bool generate_work_a)
 {
-	auto transaction (wallets.tx_begin_write ());
-	auto result (deterministic_insert (transaction, generate_work_a));
+	nano::public_key result;
+	{
+		auto transaction (wallets.tx_begin_write ());
+		result = deterministic_insert (transaction, generate_work_a);
+	}
+	// New key may be a voting representative, invalidated once the insert is committed
+	wallets.invalidate_signing_keys ();
 	return result;
 }
 
@@ -780,8 +796,11 @@ nano::public_key nano::wallet::insert_adhoc (nano::raw_key const & key_a, bool g
 		transaction.commit ();
 		if (wallets.check_rep (key, half_principal_weight))
 		{
-			nano::lock_guard<nano::mutex> lock{ representatives_mutex };
-			representatives.insert (key);
+			{
+				nano::lock_guard<nano::mutex> lock{ representatives_mutex };
+				representatives.insert (key);
+			}
+			wallets.invalidate_signing_keys ();
 		}
 	}
 	return key;
@@ -819,6 +838,9 @@ bool nano::wallet::import (std::string const & json_a, std::string const & passw
 		error = store.import (transaction, *temp);
 	}
 	temp->destroy (transaction);
+	// Imported keys may belong to voting representatives, invalidated once the import is committed
+	transaction.commit ();
+	wallets.invalidate_signing_keys ();
 	return error;
 }
 
@@ -1480,6 +1502,7 @@ void nano::wallets::destroy (nano::wallet_id const & id_a)
 	auto wallet (existing->second);
 	items.erase (existing);
 	wallet->store.destroy (transaction);
+	invalidate_signing_keys ();
 }
 
 void nano::wallets::reload ()
@@ -1523,6 +1546,7 @@ void nano::wallets::reload ()
 		debug_assert (items.find (i) == items.end ());
 		items.erase (i);
 	}
+	invalidate_signing_keys ();
 }
 
 void nano::wallets::queue_wallet_action (nano::uint128_t const & amount_a, std::shared_ptr<nano::wallet> const & wallet_a, std::function<void (nano::wallet &)> action_a)
@@ -1538,55 +1562,78 @@ void nano::wallets::foreach_representative (std::function<void (nano::public_key
 {
 	if (node.config.enable_voting)
 	{
-		std::vector<std::pair<nano::public_key const, nano::raw_key const>> action_accounts_l;
+		if (signing_keys_stale.exchange (false))
+		{
+			refresh_signing_keys ();
+		}
+		std::shared_ptr<signing_keys_t const> keys;
+		{
+			nano::lock_guard<nano::mutex> lock{ signing_keys_mutex };
+			keys = signing_keys;
+		}
+		if (keys)
 		{
-			auto transaction_l (tx_begin_read ());
-			auto ledger_txn = node.ledger.tx_begin_read ();
-			nano::lock_guard<nano::mutex> lock{ mutex };
-			for (auto i (items.begin ()), n (items.end ()); i != n; ++i)
+			for (auto const & [pub, prv] : *keys)
 			{
-				auto & wallet (*i->second);
-				nano::lock_guard<std::recursive_mutex> store_lock{ wallet.store.mutex };
-				decltype (wallet.representatives) representatives_l;
-				{
-					nano::lock_guard<nano::mutex> representatives_lock{ wallet.representatives_mutex };
-					representatives_l = wallet.representatives;
-				}
-				for (auto const & account : representatives_l)
+				action_a (pub, prv);
+			}
+		}
+	}
+}
+
+void nano::wallets::invalidate_signing_keys ()
+{
+	signing_keys_stale = true;
+}
+
+void nano::wallets::refresh_signing_keys ()
+{
+	auto keys = std::make_shared<signing_keys_t> ();
+	{
+		auto transaction_l (tx_begin_read ());
+		auto ledger_txn = node.ledger.tx_begin_read ();
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		for (auto i (items.begin ()), n (items.end ()); i != n; ++i)
+		{
+			auto & wallet (*i->second);
+			nano::lock_guard<std::recursive_mutex> store_lock{ wallet.store.mutex };
+			decltype (wallet.representatives) representatives_l;
+			{
+				nano::lock_guard<nano::mutex> representatives_lock{ wallet.representatives_mutex };
+				representatives_l = wallet.representatives;
+			}
+			for (auto const & account : representatives_l)
+			{
+				if (wallet.store.exists (transaction_l, account))
 				{
-					if (wallet.store.exists (transaction_l, account))
+					if (!node.ledger.weight_exact (ledger_txn, account).is_zero ())
 					{
-						if (!node.ledger.weight_exact (ledger_txn, account).is_zero ())
+						if (wallet.store.valid_password (transaction_l))
 						{
-							if (wallet.store.valid_password (transaction_l))
-							{
-								nano::raw_key prv;
-								auto error (wallet.store.fetch (transaction_l, account, prv));
-								(void)error;
-								debug_assert (!error);
-								action_accounts_l.emplace_back (account, prv);
-							}
-							else
+							nano::raw_key prv;
+							auto error (wallet.store.fetch (transaction_l, account, prv));
+							(void)error;
+							debug_assert (!error);
+							keys->emplace_back (account, prv);
+						}
+						else
+						{
+							// TODO: Better logging interval handling
+							static auto last_log = std::chrono::steady_clock::time_point ();
+							if (last_log < std::chrono::steady_clock::now () - std::chrono::seconds (60))
 							{
-								// TODO: Better logging interval handling
-								static auto last_log = std::chrono::steady_clock::time_point ();
-								if (last_log < std::chrono::steady_clock::now () - std::chrono::seconds (60))
-								{
-									last_log = std::chrono::steady_clock::now ();
-
-									node.logger.warn (nano::log::type::wallet, "Representative locked inside wallet: {}", i->first.to_string ());
-								}
+								last_log = std::chrono::steady_clock::now ();
+
+								node.logger.warn (nano::log::type::wallet, "Representative locked inside wallet: {}", i->first.to_string ());
 							}
 						}
 					}
 				}
 			}
 		}
-		for (auto const & representative : action_accounts_l)
-		{
-			action_a (representative.first, representative.second);
-		}
 	}
+	nano::lock_guard<nano::mutex> lock{ signing_keys_mutex };
+	signing_keys = std::move (keys);
 }
 
 bool nano::wallets::exists (store::transaction const & transaction_a, nano::account const & account_a)
@@ -1697,6 +1744,8 @@ void nano::wallets::compute_reps ()
 		nano::lock_guard<nano::mutex> representatives_guard{ wallet.representatives_mutex };
 		wallet.representatives.swap (representatives_l);
 	}
+	// Weights have possibly changed, so keys are reloaded periodically along with the representatives
+	invalidate_signing_keys ();
 }
 
 void nano::wallets::ongoing_compute_reps ()
@@ -1810,11 +1859,17 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (wa
 		items_count = wallets.items.size ();
 		actions_count = wallets.actions.size ();
 	}
+	std::size_t signing_keys_count = 0;
+	{
+		nano::lock_guard<nano::mutex> guard{ wallets.signing_keys_mutex };
+		signing_keys_count = wallets.signing_keys ? wallets.signing_keys->size () : 0;
+	}
 
 	auto sizeof_item_element = sizeof (decltype (wallets.items)::value_type);
 	auto sizeof_actions_element = sizeof (decltype (wallets.actions)::value_type);
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "items", items_count, sizeof_item_element }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "actions", actions_count, sizeof_actions_element }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "signing_keys", signing_keys_count, sizeof (decltype (wallets.signing_keys)::element_type::value_type) }));
 	return composite;
 }
@@ -139,8 +139,11 @@ public:
 	wallet (bool &, store::transaction &, nano::wallets &, std::string const &, std::string const &);
 	void enter_initial_password ();
 	bool enter_password (store::transaction const &, std::string const &);
+	/** Forgets the password, private keys cannot be used until the password is entered again */
+	void lock ();
 	nano::public_key insert_adhoc (nano::raw_key const &, bool = true);
 	bool insert_watch (store::transaction const &, nano::public_key const &);
+	/** Callers invalidate signing keys once the transaction is committed */
 	nano::public_key deterministic_insert (store::transaction const &, bool = true);
 	nano::public_key deterministic_insert (uint32_t, bool = true);
 	nano::public_key deterministic_insert (bool = true);
@@ -160,7 +163,7 @@ public:
 	bool search_receivable (store::transaction const &);
 	void init_free_accounts (store::transaction const &);
 	uint32_t deterministic_check (store::transaction const & transaction_a, uint32_t index);
-	/** Changes the wallet seed and returns the first account */
+	/** Changes the wallet seed and returns the first account. Callers invalidate signing keys once the transaction is committed */
 	nano::public_key change_seed (store::transaction const & transaction_a, nano::raw_key const & prv_a, uint32_t count = 0);
 	void deterministic_restore (store::transaction const & transaction_a);
 	bool live ();
@@ -211,7 +214,10 @@ public:
 	void reload ();
 	void do_wallet_actions ();
 	void queue_wallet_action (nano::uint128_t const &, std::shared_ptr<nano::wallet> const &, std::function<void (nano::wallet &)>);
+	/** Calls `action` with the key pair of each unlocked voting representative, from a cache that is reloaded after `invalidate_signing_keys` */
 	void foreach_representative (std::function<void (nano::public_key const &, nano::raw_key const &)> const &);
+	/** Marks cached representative keys as stale after wallet contents, wallet locks or representative weights changed */
+	void invalidate_signing_keys ();
 	bool exists (store::transaction const &, nano::account const &);
 	void start ();
 	void stop ();
@@ -246,8 +252,19 @@ public:
 	store::read_transaction tx_begin_read ();
 
 private:
+	void refresh_signing_keys ();
+
 	mutable nano::mutex reps_cache_mutex;
 	nano::wallet_representatives representatives;
+
+	// Decrypted keys of unlocked voting representatives, so signing votes needs no wallet or ledger lookups
+	// Snapshots are replaced as a whole, raw keys wipe their memory once the last reader releases a snapshot
+	using signing_keys_t = std::vector<std::pair<nano::public_key, nano::raw_key>>;
+	mutable nano::mutex signing_keys_mutex;
+	std::shared_ptr<signing_keys_t const> signing_keys;
+	std::atomic<bool> signing_keys_stale{ true };
+
+	friend std::unique_ptr<container_info_component> collect_container_info (wallets &, std::string const &);
 };
 
 std::unique_ptr<container_info_component> collect_container_info (wallets & wallets, std::string const & name);
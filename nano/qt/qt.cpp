@@ -220,6 +220,7 @@ nano_qt::accounts::accounts (nano_qt::wallet & wallet_a) :
 				});
 			}
 		}
+		this->wallet.wallet_m->wallets.invalidate_signing_keys ();
 		refresh ();
 	});
 	QObject::connect (import_wallet, &QPushButton::released, [this] () {
@@ -416,6 +417,7 @@ nano_qt::import::import (nano_qt::wallet & wallet_a) :
 				}
 				if (successful)
 				{
+					this->wallet.wallet_m->wallets.invalidate_signing_keys ();
 					seed->clear ();
 					clear_line->clear ();
 					show_line_ok (*seed);
@@ -1624,9 +1626,7 @@ nano_qt::settings::settings (nano_qt::wallet & wallet_a) :
 		if (this->wallet.wallet_m->store.valid_password (transaction))
 		{
 			// lock wallet
-			nano::raw_key empty;
-			empty.clear ();
-			this->wallet.wallet_m->store.password.value_set (empty);
+			this->wallet.wallet_m->lock ();
 			update_locked (true, true);
 			lock_toggle->setText ("Unlock");
 			this->wallet.node.logger.warn (nano::log::type::qt, "Wallet locked");
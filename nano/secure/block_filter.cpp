@@ -0,0 +1,57 @@
+#include <nano/lib/utility.hpp>
+#include <nano/secure/block_filter.hpp>
+
+#include <algorithm>
+
+nano::block_filter::block_filter (std::size_t memory) :
+	size{ std::max<std::size_t> (memory / sizeof (line), 1) },
+	lines{ std::make_unique<line[]> (size) }
+{
+}
+
+void nano::block_filter::insert (nano::block_hash const & hash)
+{
+	auto & line_l = line_for (hash);
+	for (std::size_t i = 0; i < line_l.words.size (); ++i)
+	{
+		line_l.words[i].fetch_or (mask (hash, i), std::memory_order_relaxed);
+	}
+}
+
+bool nano::block_filter::may_contain (nano::block_hash const & hash) const
+{
+	auto const & line_l = line_for (hash);
+	for (std::size_t i = 0; i < line_l.words.size (); ++i)
+	{
+		auto const bit = mask (hash, i);
+		if ((line_l.words[i].load (std::memory_order_relaxed) & bit) != bit)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+std::size_t nano::block_filter::memory () const
+{
+	return size * sizeof (line);
+}
+
+auto nano::block_filter::line_for (nano::block_hash const & hash) const -> line &
+{
+	// Block hashes are uniformly distributed already, no further hashing is needed
+	return lines[hash.qwords[0] % size];
+}
+
+uint64_t nano::block_filter::mask (nano::block_hash const & hash, std::size_t word)
+{
+	// Bit positions within each word are taken from consecutive 6 bit groups of the second quad word, independent from the line index
+	return uint64_t{ 1 } << ((hash.qwords[1] >> (word * 6)) & 63);
+}
+
+std::unique_ptr<nano::container_info_component> nano::block_filter::collect_container_info (std::string const & name) const
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lines", size, sizeof (line) }));
+	return composite;
+}
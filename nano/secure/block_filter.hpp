@@ -0,0 +1,46 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace nano
+{
+class container_info_component;
+
+/**
+ * Blocked bloom filter over block hashes, answers most lookups for blocks missing from the ledger without touching the database.
+ * Each hash maps to a single cache line and sets one bit in each of its eight words.
+ * Hashes cannot be removed, blocks that were rolled back remain as false positives until the filter is rebuilt on the next startup.
+ * Inserts and lookups are lock free and may be called concurrently.
+ */
+class block_filter final
+{
+public:
+	/** @param memory Size of the filter in bytes, rounded down to whole cache lines */
+	explicit block_filter (std::size_t memory);
+
+	void insert (nano::block_hash const &);
+	/** @return false if the hash has definitely not been inserted */
+	bool may_contain (nano::block_hash const &) const;
+
+	std::size_t memory () const;
+
+	std::unique_ptr<nano::container_info_component> collect_container_info (std::string const & name) const;
+
+private:
+	struct alignas (64) line
+	{
+		std::array<std::atomic<uint64_t>, 8> words{};
+	};
+
+	line & line_for (nano::block_hash const &) const;
+	static uint64_t mask (nano::block_hash const &, std::size_t word);
+
+	std::size_t const size;
+	std::unique_ptr<line[]> lines;
+};
+}
@@ -1,10 +1,14 @@
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/stats.hpp>
+#include <nano/lib/thread_roles.hpp>
+#include <nano/lib/threading.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/lib/work.hpp>
 #include <nano/node/make_store.hpp>
+#include <nano/secure/block_filter.hpp>
 #include <nano/secure/common.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
@@ -14,15 +18,18 @@
 #include <nano/store/block.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
+#include <nano/store/counters.hpp>
 #include <nano/store/final.hpp>
 #include <nano/store/online_weight.hpp>
 #include <nano/store/peer.hpp>
 #include <nano/store/pending.hpp>
 #include <nano/store/pruned.hpp>
 #include <nano/store/rep_weight.hpp>
+#include <nano/store/unconfirmed.hpp>
 #include <nano/store/version.hpp>
 
 #include <stack>
+#include <thread>
 
 #include <cryptopp/words.h>
 
@@ -711,7 +718,7 @@ void representative_visitor::state_block (nano::state_block const & block_a)
 }
 } // namespace
 
-nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, nano::ledger_constants & constants, nano::generate_cache_flags const & generate_cache_flags_a, nano::uint128_t min_rep_weight_a) :
+nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, nano::ledger_constants & constants, nano::generate_cache_flags const & generate_cache_flags_a, nano::uint128_t min_rep_weight_a, std::size_t block_filter_memory) :
 	constants{ constants },
 	store{ store_a },
 	cache{ store_a.rep_weight, min_rep_weight_a },
@@ -722,6 +729,12 @@ nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, na
 	any{ *any_impl },
 	confirmed{ *confirmed_impl }
 {
+	if (block_filter_memory > 0)
+	{
+		block_filter = std::make_unique<nano::block_filter> (block_filter_memory);
+		// Genesis is written by store initialization, which can happen after the ledger has been constructed
+		block_filter->insert (constants.genesis->hash ());
+	}
 	if (!store.init_error ())
 	{
 		initialize (generate_cache_flags_a);
@@ -746,22 +759,23 @@ auto nano::ledger::tx_begin_read () const -> secure::read_transaction
 
 void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache_flags_a)
 {
-	if (generate_cache_flags_a.reps || generate_cache_flags_a.account_count || generate_cache_flags_a.block_count)
+	auto transaction (store.tx_begin_read ());
+
+	// Use persisted counters when available, full table scans are only needed for ledgers that have not stored them yet
+	auto counts = store.counters.get (transaction);
+	if (!counts && (generate_cache_flags_a.account_count || generate_cache_flags_a.block_count || generate_cache_flags_a.cemented_count))
 	{
-		store.account.for_each_par (
-		[this] (store::read_transaction const & /*unused*/, store::iterator<nano::account, nano::account_info> i, store::iterator<nano::account, nano::account_info> n) {
-			uint64_t block_count_l{ 0 };
-			uint64_t account_count_l{ 0 };
-			for (; i != n; ++i)
-			{
-				nano::account_info const & info (i->second);
-				block_count_l += info.block_count;
-				++account_count_l;
-			}
-			this->cache.block_count += block_count_l;
-			this->cache.account_count += account_count_l;
-		});
+		counts = scan_counts ();
+	}
 
+	if (counts && (generate_cache_flags_a.account_count || generate_cache_flags_a.block_count))
+	{
+		cache.block_count = counts.value ().block_count;
+		cache.account_count = counts.value ().account_count;
+	}
+
+	if (generate_cache_flags_a.reps)
+	{
 		store.rep_weight.for_each_par (
 		[this] (store::read_transaction const & /*unused*/, store::iterator<nano::account, nano::uint128_union> i, store::iterator<nano::account, nano::uint128_union> n) {
 			nano::rep_weights rep_weights_l{ this->store.rep_weight };
@@ -773,21 +787,181 @@ void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache
 		});
 	}
 
-	if (generate_cache_flags_a.cemented_count)
+	if (counts && generate_cache_flags_a.cemented_count)
 	{
-		store.confirmation_height.for_each_par (
-		[this] (store::read_transaction const & /*unused*/, store::iterator<nano::account, nano::confirmation_height_info> i, store::iterator<nano::account, nano::confirmation_height_info> n) {
-			uint64_t cemented_count_l (0);
-			for (; i != n; ++i)
-			{
-				cemented_count_l += i->second.height;
-			}
-			this->cache.cemented_count += cemented_count_l;
-		});
+		cache.cemented_count = counts.value ().cemented_count;
 	}
 
-	auto transaction (store.tx_begin_read ());
+	persist_counters = counts && generate_cache_flags_a.account_count && generate_cache_flags_a.block_count && generate_cache_flags_a.cemented_count;
+
 	cache.pruned_count = store.pruned.count (transaction);
+
+	if (block_filter)
+	{
+		fill_block_filter ();
+	}
+}
+
+void nano::ledger::fill_block_filter () const
+{
+	// Keys are inserted straight from their serialized form so blocks are not deserialized, work is split on the first key byte
+	std::size_t constexpr ranges = 16;
+	std::atomic<std::size_t> next{ 0 };
+	auto worker = [this, &next] () {
+		nano::thread_role::set (nano::thread_role::name::block_filter);
+		auto transaction = store.tx_begin_read ();
+		for (auto task = next++; task < 2 * ranges; task = next++)
+		{
+			auto const table = task < ranges ? nano::tables::blocks : nano::tables::pruned;
+			auto const range = task % ranges;
+			std::array<uint8_t, 1> const start{ static_cast<uint8_t> (range * (256 / ranges)) };
+			std::array<uint8_t, 1> const end{ static_cast<uint8_t> ((range + 1) * (256 / ranges)) };
+			auto const start_span = range == 0 ? std::span<uint8_t const>{} : std::span<uint8_t const>{ start };
+			auto const end_span = range == ranges - 1 ? std::span<uint8_t const>{} : std::span<uint8_t const>{ end };
+			store.raw_for_each (transaction, table, start_span, end_span, [this] (std::span<uint8_t const> key, std::span<uint8_t const> /* value */) {
+				nano::block_hash hash;
+				release_assert (key.size () == hash.bytes.size ());
+				std::copy (key.begin (), key.end (), hash.bytes.begin ());
+				block_filter->insert (hash);
+				return true;
+			});
+		}
+	};
+
+	std::vector<std::thread> threads;
+	auto const thread_count = std::max (1u, std::min (nano::hardware_concurrency (), static_cast<unsigned> (ranges)));
+	for (unsigned i = 0; i < thread_count; ++i)
+	{
+		threads.emplace_back (worker);
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+}
+
+bool nano::ledger::block_maybe_exists (nano::block_hash const & hash) const
+{
+	if (block_filter && !block_filter->may_contain (hash))
+	{
+		stats.inc (nano::stat::type::block_filter, nano::stat::detail::filtered);
+		return false;
+	}
+	return true;
+}
+
+void nano::ledger::block_filter_miss () const
+{
+	if (block_filter)
+	{
+		stats.inc (nano::stat::type::block_filter, nano::stat::detail::false_positive);
+	}
+}
+
+nano::store::ledger_counts nano::ledger::scan_counts () const
+{
+	std::atomic<uint64_t> block_count{ 0 };
+	std::atomic<uint64_t> account_count{ 0 };
+	std::atomic<uint64_t> cemented_count{ 0 };
+
+	store.account.for_each_par (
+	[&] (store::read_transaction const & /*unused*/, store::iterator<nano::account, nano::account_info> i, store::iterator<nano::account, nano::account_info> n) {
+		uint64_t block_count_l{ 0 };
+		uint64_t account_count_l{ 0 };
+		for (; i != n; ++i)
+		{
+			nano::account_info const & info (i->second);
+			block_count_l += info.block_count;
+			++account_count_l;
+		}
+		block_count += block_count_l;
+		account_count += account_count_l;
+	});
+
+	store.confirmation_height.for_each_par (
+	[&] (store::read_transaction const & /*unused*/, store::iterator<nano::account, nano::confirmation_height_info> i, store::iterator<nano::account, nano::confirmation_height_info> n) {
+		uint64_t cemented_count_l (0);
+		for (; i != n; ++i)
+		{
+			cemented_count_l += i->second.height;
+		}
+		cemented_count += cemented_count_l;
+	});
+
+	return { block_count, account_count, cemented_count };
+}
+
+void nano::ledger::persist_counts (secure::write_transaction const & transaction)
+{
+	if (!persist_counters)
+	{
+		// Cached counts are incomplete, drop any stored counters so the next startup falls back to a full scan
+		if (store.counters.get (transaction))
+		{
+			store.counters.del (transaction);
+		}
+		return;
+	}
+	store.counters.put (transaction, { cache.block_count, cache.account_count, cache.cemented_count });
+}
+
+void nano::ledger::update_unconfirmed (secure::write_transaction const & transaction, nano::account const & account)
+{
+	auto info = any.account_get (transaction, account);
+	nano::confirmation_height_info conf_info;
+	store.confirmation_height.get (transaction, account, conf_info);
+	bool const unconfirmed = info && conf_info.height < info->block_count;
+	bool const indexed = store.unconfirmed.exists (transaction, account);
+	if (unconfirmed && !indexed)
+	{
+		store.unconfirmed.put (transaction, account);
+	}
+	else if (!unconfirmed && indexed)
+	{
+		store.unconfirmed.del (transaction, account);
+	}
+}
+
+bool nano::ledger::verify_counts ()
+{
+	// Persisted counters are compared against a full scan of the same snapshot
+	// Any difference is applied as a delta, so that changes committed while scanning are preserved
+	nano::store::ledger_counts persisted;
+	nano::store::ledger_counts scanned;
+	{
+		auto transaction = tx_begin_read ();
+		auto counts = store.counters.get (transaction);
+		if (!counts)
+		{
+			return true; // Nothing to verify
+		}
+		persisted = counts.value ();
+
+		for (auto i = store.account.begin (transaction), n = store.account.end (); i != n; ++i)
+		{
+			scanned.block_count += i->second.block_count;
+			++scanned.account_count;
+		}
+		for (auto i = store.confirmation_height.begin (transaction), n = store.confirmation_height.end (); i != n; ++i)
+		{
+			scanned.cemented_count += i->second.height;
+		}
+	}
+
+	if (scanned == persisted)
+	{
+		stats.inc (nano::stat::type::ledger, nano::stat::detail::counters_verified);
+		return true;
+	}
+
+	stats.inc (nano::stat::type::ledger, nano::stat::detail::counters_mismatch);
+
+	auto transaction = tx_begin_write ({ tables::meta }, nano::store::writer::generic);
+	cache.block_count += scanned.block_count - persisted.block_count;
+	cache.account_count += scanned.account_count - persisted.account_count;
+	cache.cemented_count += scanned.cemented_count - persisted.cemented_count;
+	persist_counts (transaction);
+	return false;
 }
 
 nano::uint128_t nano::ledger::account_receivable (secure::transaction const & transaction_a, nano::account const & account_a, bool only_confirmed_a)
@@ -884,6 +1058,8 @@ void nano::ledger::confirm_one (secure::write_transaction & transaction, nano::b
 	confirmation_height_info info{ block.sideband ().height, block.hash () };
 	store.confirmation_height.put (transaction, block.account (), info);
 	++cache.cemented_count;
+	persist_counts (transaction);
+	update_unconfirmed (transaction, block.account ());
 
 	stats.inc (nano::stat::type::confirmation_height, nano::stat::detail::blocks_confirmed);
 }
@@ -895,7 +1071,14 @@ nano::block_status nano::ledger::process (secure::write_transaction const & tran
 	block_a->visit (processor);
 	if (processor.result == nano::block_status::progress)
 	{
+		// Inserted before the transaction commits so readers never see the block missing from the filter
+		if (block_filter)
+		{
+			block_filter->insert (block_a->hash ());
+		}
 		++cache.block_count;
+		persist_counts (transaction_a);
+		update_unconfirmed (transaction_a, block_a->account ());
 	}
 	return processor.result;
 }
@@ -962,6 +1145,11 @@ std::pair<nano::block_hash, nano::block_hash> nano::ledger::hash_root_random (se
 
 // Vote weight of an account
 nano::uint128_t nano::ledger::weight (nano::account const & account_a) const
+{
+	return nano::from_native (weight_native (account_a));
+}
+
+nano::uint128_native_t nano::ledger::weight_native (nano::account const & account_a) const
 {
 	if (check_bootstrap_weights.load ())
 	{
@@ -970,7 +1158,7 @@ nano::uint128_t nano::ledger::weight (nano::account const & account_a) const
 			auto weight = bootstrap_weights.find (account_a);
 			if (weight != bootstrap_weights.end ())
 			{
-				return weight->second;
+				return nano::to_native (weight->second);
 			}
 		}
 		else
@@ -978,7 +1166,7 @@ nano::uint128_t nano::ledger::weight (nano::account const & account_a) const
 			check_bootstrap_weights = false;
 		}
 	}
-	return cache.rep_weights.representation_get (account_a);
+	return cache.rep_weights.representation_get_native (account_a);
 }
 
 nano::uint128_t nano::ledger::weight_exact (secure::transaction const & txn_a, nano::account const & representative_a) const
@@ -1016,6 +1204,8 @@ bool nano::ledger::rollback (secure::write_transaction const & transaction_a, na
 			error = true;
 		}
 	}
+	persist_counts (transaction_a);
+	update_unconfirmed (transaction_a, account_l);
 	return error;
 }
 
@@ -1258,7 +1448,7 @@ uint64_t nano::ledger::pruning_action (secure::write_transaction & transaction_a
 }
 
 // A precondition is that the store is an LMDB store
-bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_path_a) const
+bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_path_a, bool bulk_ingest_a) const
 {
 	nano::logger logger;
 
@@ -1287,144 +1477,146 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 
 	if (!rocksdb_store->init_error ())
 	{
-		auto table_size = store.count (store.tx_begin_read (), tables::blocks);
-		logger.info (nano::log::type::ledger, "Step 1 of 7: Converting {} entries from blocks table", table_size);
-		std::atomic<std::size_t> count = 0;
-		store.block.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::blocks }));
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				std::vector<uint8_t> vector;
-				{
-					nano::vectorstream stream (vector);
-					nano::serialize_block (stream, *i->second.block);
-					i->second.sideband.serialize (stream, i->second.block->type ());
-				}
-				rocksdb_store->block.raw_put (rocksdb_transaction, vector, i->first);
+		auto ingest_path = data_path_a / "rocksdb_ingest";
+		if (bulk_ingest_a)
+		{
+			std::filesystem::remove_all (ingest_path);
+			std::filesystem::create_directories (ingest_path);
+		}
 
-				if (auto count_l = ++count; count_l % 5000000 == 0)
+		/*
+		 * Copies a single table. In transaction mode `copy` writes the entry pointed to by the LMDB iterator to the RocksDB store.
+		 * In bulk ingest mode raw entries are copied instead, every range of the first key byte is written into its own external file.
+		 * Ranges don't overlap and LMDB iterates keys in the same bytewise order as the RocksDB comparator, so the files can be ingested without sorting or compaction.
+		 */
+		auto convert = [&] (unsigned step, nano::tables table, std::string_view name, auto const & source, std::size_t progress_interval, auto const & copy) {
+			auto table_size = store.count (store.tx_begin_read (), table);
+			logger.info (nano::log::type::ledger, "Step {} of 8: Converting {} entries from {} table", step, table_size, name);
+
+			std::atomic<std::size_t> count = 0;
+			auto progress = [&] () {
+				if (auto count_l = ++count; count_l % progress_interval == 0)
 				{
-					logger.info (nano::log::type::ledger, "{} blocks converted ({}%)", count_l, count_l * 100 / table_size);
+					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
 				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::pending);
-		logger.info (nano::log::type::ledger, "Step 2 of 7: Converting {} entries from pending table", table_size);
-		count = 0;
-		store.pending.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::pending }));
-			for (; i != n; ++i)
+			};
+
+			if (bulk_ingest_a)
 			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->pending.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
+				std::size_t constexpr ranges = 16;
+				std::atomic<std::size_t> next = 0;
+				std::atomic<bool> failed = false;
+				std::vector<std::filesystem::path> files;
+				nano::mutex files_mutex;
+				auto worker = [&] () {
+					nano::thread_role::set (nano::thread_role::name::db_parallel_traversal);
+					auto transaction = store.tx_begin_read ();
+					for (auto range = next++; range < ranges && !failed; range = next++)
+					{
+						std::array<uint8_t, 1> const start{ static_cast<uint8_t> (range * (256 / ranges)) };
+						std::array<uint8_t, 1> const end{ static_cast<uint8_t> ((range + 1) * (256 / ranges)) };
+						auto const start_span = range == 0 ? std::span<uint8_t const>{} : std::span<uint8_t const>{ start };
+						auto const end_span = range == ranges - 1 ? std::span<uint8_t const>{} : std::span<uint8_t const>{ end };
+						auto file = ingest_path / fmt::format ("{}_{}.sst", name, range);
+						auto writer = rocksdb_store->ingest_writer (table, file);
+						release_assert (writer != nullptr);
+						store.raw_for_each (transaction, table, start_span, end_span, [&] (std::span<uint8_t const> key, std::span<uint8_t const> value) {
+							if (writer->put (key, value))
+							{
+								failed = true;
+							}
+							progress ();
+							return !failed;
+						});
+						if (writer->finish ())
+						{
+							failed = true;
+						}
+						nano::lock_guard<nano::mutex> guard{ files_mutex };
+						files.push_back (file);
+					}
+				};
+				std::vector<std::thread> threads;
+				auto const thread_count = std::max (1u, std::min (nano::hardware_concurrency (), static_cast<unsigned> (ranges)));
+				for (unsigned i = 0; i < thread_count; ++i)
 				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
+					threads.emplace_back (worker);
 				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::confirmation_height);
-		logger.info (nano::log::type::ledger, "Step 3 of 7: Converting {} entries from confirmation_height table", table_size);
-		count = 0;
-		store.confirmation_height.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::confirmation_height }));
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->confirmation_height.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
+				for (auto & thread : threads)
 				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
+					thread.join ();
 				}
+				logger.info (nano::log::type::ledger, "Ingesting {} files into {} table", files.size (), name);
+				error |= failed || rocksdb_store->ingest (table, files);
 			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::accounts);
-		logger.info (nano::log::type::ledger, "Step 4 of 7: Converting {} entries from accounts table", table_size);
-		count = 0;
-		store.account.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::accounts }));
-			for (; i != n; ++i)
+			else
 			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->account.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
+				source.for_each_par (
+				[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
+					auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { table }));
+					for (; i != n; ++i)
+					{
+						rocksdb_transaction.refresh_if_needed ();
+						copy (rocksdb_transaction, i);
+						progress ();
+					}
+				});
 			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
+			logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
 
-		table_size = store.count (store.tx_begin_read (), tables::rep_weights);
-		logger.info (nano::log::type::ledger, "Step 5 of 7: Converting {} entries from rep_weights table", table_size);
-		count = 0;
-		store.rep_weight.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::rep_weights }));
-			for (; i != n; ++i)
+			// The LMDB ledger is not modified during migration, every entry must have been visited exactly once
+			if (count != table_size)
 			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->rep_weight.put (rocksdb_transaction, i->first, i->second.number ());
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
+				logger.error (nano::log::type::ledger, "Converted {} entries from {} table, expected {}", count.load (), name, table_size);
+				error = true;
 			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::pruned);
-		logger.info (nano::log::type::ledger, "Step 6 of 7: Converting {} entries from pruned table", table_size);
-		count = 0;
-		store.pruned.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::pruned }));
-			for (; i != n; ++i)
+		};
+
+		convert (1, tables::blocks, "blocks", store.block, 5000000, [&] (auto const & transaction, auto & i) {
+			std::vector<uint8_t> vector;
 			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->pruned.put (rocksdb_transaction, i->first);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
+				nano::vectorstream stream (vector);
+				nano::serialize_block (stream, *i->second.block);
+				i->second.sideband.serialize (stream, i->second.block->type ());
 			}
+			rocksdb_store->block.raw_put (transaction, vector, i->first);
 		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::final_votes);
-		logger.info (nano::log::type::ledger, "Step 7 of 7: Converting {} entries from final_votes table", table_size);
-		count = 0;
-		store.final_vote.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::final_votes }));
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->final_vote.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
+		convert (2, tables::pending, "pending", store.pending, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->pending.put (transaction, i->first, i->second);
+		});
+		convert (3, tables::confirmation_height, "confirmation_height", store.confirmation_height, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->confirmation_height.put (transaction, i->first, i->second);
+		});
+		convert (4, tables::accounts, "accounts", store.account, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->account.put (transaction, i->first, i->second);
+		});
+		convert (5, tables::rep_weights, "rep_weights", store.rep_weight, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->rep_weight.put (transaction, i->first, i->second.number ());
+		});
+		convert (6, tables::pruned, "pruned", store.pruned, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->pruned.put (transaction, i->first);
 		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
+		convert (7, tables::final_votes, "final_votes", store.final_vote, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->final_vote.put (transaction, i->first, i->second);
+		});
+		convert (8, tables::unconfirmed, "unconfirmed", store.unconfirmed, 500000, [&] (auto const & transaction, auto & i) {
+			rocksdb_store->unconfirmed.put (transaction, i->first);
+		});
+
+		if (bulk_ingest_a)
+		{
+			std::filesystem::remove_all (ingest_path);
+		}
 
 		logger.info (nano::log::type::ledger, "Finalizing migration...");
 		auto lmdb_transaction (store.tx_begin_read ());
 		auto version = store.version.get (lmdb_transaction);
 		auto rocksdb_transaction (rocksdb_store->tx_begin_write ());
 		rocksdb_store->version.put (rocksdb_transaction, version);
+		if (auto counts = store.counters.get (lmdb_transaction))
+		{
+			rocksdb_store->counters.put (rocksdb_transaction, counts.value ());
+		}
 
 		for (auto i (store.online_weight.begin (lmdb_transaction)), n (store.online_weight.end ()); i != n; ++i)
 		{
@@ -1442,6 +1634,7 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 		error |= store.final_vote.count (lmdb_transaction) != rocksdb_store->final_vote.count (rocksdb_transaction);
 		error |= store.online_weight.count (lmdb_transaction) != rocksdb_store->online_weight.count (rocksdb_transaction);
 		error |= store.rep_weight.count (lmdb_transaction) != rocksdb_store->rep_weight.count (rocksdb_transaction);
+		error |= store.unconfirmed.count (lmdb_transaction) != rocksdb_store->unconfirmed.count (rocksdb_transaction);
 		error |= store.version.get (lmdb_transaction) != rocksdb_store->version.get (rocksdb_transaction);
 
 		// For large tables a random key is used instead and makes sure it exists
@@ -1521,5 +1714,9 @@ std::unique_ptr<nano::container_info_component> nano::ledger::collect_container_
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "bootstrap_weights", count, sizeof_element }));
 	composite->add_component (cache.rep_weights.collect_container_info ("rep_weights"));
+	if (block_filter)
+	{
+		composite->add_component (block_filter->collect_container_info ("block_filter"));
+	}
 	return composite;
 }
@@ -15,11 +15,13 @@
 namespace nano::store
 {
 class component;
+class ledger_counts;
 }
 
 namespace nano
 {
 class block;
+class block_filter;
 enum class block_status;
 enum class epoch : uint8_t;
 class ledger_constants;
@@ -35,7 +37,8 @@ class ledger final
 	friend class receivable_iterator;
 
 public:
-	ledger (nano::store::component &, nano::stats &, nano::ledger_constants & constants, nano::generate_cache_flags const & = nano::generate_cache_flags{}, nano::uint128_t min_rep_weight_a = 0);
+	/** @param block_filter_memory Size in bytes of the in-memory filter used to skip database lookups for missing blocks, zero disables it */
+	ledger (nano::store::component &, nano::stats &, nano::ledger_constants & constants, nano::generate_cache_flags const & = nano::generate_cache_flags{}, nano::uint128_t min_rep_weight_a = 0, std::size_t block_filter_memory = 0);
 	~ledger ();
 
 	/** Start read-write transaction */
@@ -50,6 +53,8 @@ public:
 	 * During bootstrap it returns the preconfigured bootstrap weights.
 	 */
 	nano::uint128_t weight (nano::account const &) const;
+	/* Same as `weight`, as a native integer for summing weights in hot loops */
+	nano::uint128_native_t weight_native (nano::account const &) const;
 	/* Returns the exact vote weight for the given representative by doing a database lookup */
 	nano::uint128_t weight_exact (secure::transaction const &, nano::account const &) const;
 	std::shared_ptr<nano::block> forked_block (secure::transaction const &, nano::block const &);
@@ -73,7 +78,7 @@ public:
 	std::shared_ptr<nano::block> find_receive_block_by_send_hash (secure::transaction const &, nano::account const & destination, nano::block_hash const & send_block_hash);
 	nano::account const & epoch_signer (nano::link const &) const;
 	nano::link const & epoch_link (nano::epoch) const;
-	bool migrate_lmdb_to_rocksdb (std::filesystem::path const &) const;
+	bool migrate_lmdb_to_rocksdb (std::filesystem::path const &, bool bulk_ingest = false) const;
 	bool bootstrap_weight_reached () const;
 	static nano::epoch version (nano::block const & block);
 	nano::epoch version (secure::transaction const &, nano::block_hash const & hash) const;
@@ -81,6 +86,16 @@ public:
 	uint64_t block_count () const;
 	uint64_t account_count () const;
 	uint64_t pruned_count () const;
+	/**
+	 * Compares persisted ledger counters against a full scan of the ledger and corrects them if needed
+	 * This is slow and holds a read transaction for the duration of the scan
+	 * @return true if counters were consistent
+	 */
+	bool verify_counts ();
+	/** Returns false if the block is definitely neither in the blocks nor in the pruned table, without querying the database */
+	bool block_maybe_exists (nano::block_hash const &) const;
+	/** Records a false positive of `block_maybe_exists` that was resolved by the database */
+	void block_filter_miss () const;
 
 	std::unique_ptr<container_info_component> collect_container_info (std::string const & name) const;
 
@@ -101,6 +116,17 @@ public:
 private:
 	void initialize (nano::generate_cache_flags const &);
 	void confirm_one (secure::write_transaction &, nano::block const & block);
+	nano::store::ledger_counts scan_counts () const;
+	void fill_block_filter () const;
+	void persist_counts (secure::write_transaction const &);
+	/** Keeps the unconfirmed accounts index in sync after blocks of `account` were processed, confirmed or rolled back */
+	void update_unconfirmed (secure::write_transaction const &, nano::account const & account);
+
+	// Counters are only persisted when all cached counts were loaded during initialization
+	bool persist_counters{ false };
+
+	// Null when disabled
+	std::unique_ptr<nano::block_filter> block_filter;
 
 	std::unique_ptr<ledger_set_any> any_impl;
 	std::unique_ptr<ledger_set_confirmed> confirmed_impl;
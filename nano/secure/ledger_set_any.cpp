@@ -123,16 +123,25 @@ std::optional<nano::amount> nano::ledger_set_any::block_balance (secure::transac
 
 bool nano::ledger_set_any::block_exists (secure::transaction const & transaction, nano::block_hash const & hash) const
 {
+	if (!ledger.block_maybe_exists (hash))
+	{
+		return false;
+	}
 	return ledger.store.block.exists (transaction, hash);
 }
 
 bool nano::ledger_set_any::block_exists_or_pruned (secure::transaction const & transaction, nano::block_hash const & hash) const
 {
-	if (ledger.store.pruned.exists (transaction, hash))
+	if (!ledger.block_maybe_exists (hash))
+	{
+		return false;
+	}
+	if (ledger.store.pruned.exists (transaction, hash) || ledger.store.block.exists (transaction, hash))
 	{
 		return true;
 	}
-	return ledger.store.block.exists (transaction, hash);
+	ledger.block_filter_miss ();
+	return false;
 }
 
 std::shared_ptr<nano::block> nano::ledger_set_any::block_get (secure::transaction const & transaction, nano::block_hash const & hash) const
@@ -64,6 +64,10 @@ bool nano::ledger_set_confirmed::block_exists (secure::transaction const & trans
 
 bool nano::ledger_set_confirmed::block_exists_or_pruned (secure::transaction const & transaction, nano::block_hash const & hash) const
 {
+	if (!ledger.block_maybe_exists (hash))
+	{
+		return false;
+	}
 	if (ledger.store.pruned.exists (transaction, hash))
 	{
 		return true;
@@ -5,7 +5,7 @@
 
 nano::rep_weights::rep_weights (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_weight_a) :
 	rep_weight_store{ rep_weight_store_a },
-	min_weight{ min_weight_a }
+	min_weight{ nano::to_native (min_weight_a) }
 {
 }
 
@@ -15,7 +15,7 @@ void nano::rep_weights::representation_add (store::write_transaction const & txn
 	auto new_weight = previous_weight + amount_a;
 	put_store (txn_a, rep_a, previous_weight, new_weight);
 	std::unique_lock guard{ mutex };
-	put_cache (rep_a, new_weight);
+	put_cache (rep_a, nano::to_native (new_weight));
 }
 
 void nano::rep_weights::representation_add_dual (store::write_transaction const & txn_a, nano::account const & rep_1, nano::uint128_t const & amount_1, nano::account const & rep_2, nano::uint128_t const & amount_2)
@@ -29,8 +29,8 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 		put_store (txn_a, rep_1, previous_weight_1, new_weight_1);
 		put_store (txn_a, rep_2, previous_weight_2, new_weight_2);
 		std::unique_lock guard{ mutex };
-		put_cache (rep_1, new_weight_1);
-		put_cache (rep_2, new_weight_2);
+		put_cache (rep_1, nano::to_native (new_weight_1));
+		put_cache (rep_2, nano::to_native (new_weight_2));
 	}
 	else
 	{
@@ -41,10 +41,15 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 void nano::rep_weights::representation_put (nano::account const & account_a, nano::uint128_t const & representation_a)
 {
 	std::unique_lock guard{ mutex };
-	put_cache (account_a, representation_a);
+	put_cache (account_a, nano::to_native (representation_a));
 }
 
 nano::uint128_t nano::rep_weights::representation_get (nano::account const & account_a) const
+{
+	return nano::from_native (representation_get_native (account_a));
+}
+
+nano::uint128_native_t nano::rep_weights::representation_get_native (nano::account const & account_a) const
 {
 	std::shared_lock lk{ mutex };
 	return get (account_a);
@@ -54,7 +59,13 @@ nano::uint128_t nano::rep_weights::representation_get (nano::account const & acc
 std::unordered_map<nano::account, nano::uint128_t> nano::rep_weights::get_rep_amounts () const
 {
 	std::shared_lock guard{ mutex };
-	return rep_amounts;
+	std::unordered_map<nano::account, nano::uint128_t> result;
+	result.reserve (rep_amounts.size ());
+	for (auto const & [account, amount] : rep_amounts)
+	{
+		result.emplace (account, nano::from_native (amount));
+	}
+	return result;
 }
 
 void nano::rep_weights::copy_from (nano::rep_weights & other_a)
@@ -68,10 +79,10 @@ void nano::rep_weights::copy_from (nano::rep_weights & other_a)
 	}
 }
 
-void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint128_union const & representation_a)
+void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint128_native_t representation_a)
 {
 	auto it = rep_amounts.find (account_a);
-	if (representation_a < min_weight || representation_a.is_zero ())
+	if (representation_a < min_weight || representation_a == 0)
 	{
 		if (it != rep_amounts.end ())
 		{
@@ -80,14 +91,13 @@ void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint12
 	}
 	else
 	{
-		auto amount = representation_a.number ();
 		if (it != rep_amounts.end ())
 		{
-			it->second = amount;
+			it->second = representation_a;
 		}
 		else
 		{
-			rep_amounts.emplace (account_a, amount);
+			rep_amounts.emplace (account_a, representation_a);
 		}
 	}
 }
@@ -107,7 +117,7 @@ void nano::rep_weights::put_store (store::write_transaction const & txn_a, nano:
 	}
 }
 
-nano::uint128_t nano::rep_weights::get (nano::account const & account_a) const
+nano::uint128_native_t nano::rep_weights::get (nano::account const & account_a) const
 {
 	auto it = rep_amounts.find (account_a);
 	if (it != rep_amounts.end ())
@@ -116,7 +126,7 @@ nano::uint128_t nano::rep_weights::get (nano::account const & account_a) const
 	}
 	else
 	{
-		return nano::uint128_t{ 0 };
+		return 0;
 	}
 }
 
@@ -23,6 +23,7 @@ public:
 	void representation_add (store::write_transaction const & txn_a, nano::account const & source_rep_a, nano::uint128_t const & amount_a);
 	void representation_add_dual (store::write_transaction const & txn_a, nano::account const & source_rep_1, nano::uint128_t const & amount_1, nano::account const & source_rep_2, nano::uint128_t const & amount_2);
 	nano::uint128_t representation_get (nano::account const & account_a) const;
+	nano::uint128_native_t representation_get_native (nano::account const & account_a) const;
 	/* Only use this method when loading rep weights from the database table */
 	void representation_put (nano::account const & account_a, nano::uint128_t const & representation_a);
 	std::unordered_map<nano::account, nano::uint128_t> get_rep_amounts () const;
@@ -33,11 +34,12 @@ public:
 
 private:
 	mutable std::shared_mutex mutex;
-	std::unordered_map<nano::account, nano::uint128_t> rep_amounts;
+	// Cached weights are kept as native integers, weights are read for every vote when tallying elections
+	std::unordered_map<nano::account, nano::uint128_native_t> rep_amounts;
 	nano::store::rep_weight & rep_weight_store;
-	nano::uint128_t min_weight;
-	void put_cache (nano::account const & account_a, nano::uint128_union const & representation_a);
+	nano::uint128_native_t const min_weight;
+	void put_cache (nano::account const & account_a, nano::uint128_native_t representation_a);
 	void put_store (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & previous_weight_a, nano::uint128_t const & new_weight_a);
-	nano::uint128_t get (nano::account const & account_a) const;
+	nano::uint128_native_t get (nano::account const & account_a) const;
 };
 }
@@ -4,29 +4,35 @@
 
 #include <boost/property_tree/json_parser.hpp>
 
+nano::vote::vote () :
+	hash_m{ compute_hash () }
+{
+}
+
 nano::vote::vote (bool & error_a, nano::stream & stream_a)
 {
 	error_a = deserialize (stream_a);
 }
 
-nano::vote::vote (nano::account const & account_a, nano::raw_key const & prv_a, uint64_t timestamp_a, uint8_t duration, std::vector<nano::block_hash> const & hashes) :
-	hashes{ hashes },
+nano::vote::vote (nano::account const & account_a, nano::raw_key const & prv_a, uint64_t timestamp_a, uint8_t duration, std::vector<nano::block_hash> const & hashes_a) :
+	account{ account_a },
 	timestamp_m{ packed_timestamp (timestamp_a, duration) },
-	account{ account_a }
+	hashes_m (hashes_a.begin (), hashes_a.end ())
 {
-	debug_assert (hashes.size () <= max_hashes);
+	debug_assert (hashes_m.size () <= max_hashes);
 
+	hash_m = compute_hash ();
 	signature = nano::sign_message (prv_a, account_a, hash ());
 }
 
 void nano::vote::serialize (nano::stream & stream_a) const
 {
-	debug_assert (hashes.size () <= max_hashes);
+	debug_assert (hashes_m.size () <= max_hashes);
 
 	write (stream_a, account);
 	write (stream_a, signature);
 	write (stream_a, boost::endian::native_to_little (timestamp_m));
-	for (auto const & hash : hashes)
+	for (auto const & hash : hashes_m)
 	{
 		write (stream_a, hash);
 	}
@@ -41,12 +47,15 @@ bool nano::vote::deserialize (nano::stream & stream_a)
 		nano::read (stream_a, signature.bytes);
 		nano::read (stream_a, timestamp_m);
 
-		while (stream_a.in_avail () > 0 && hashes.size () < max_hashes)
+		auto const available = std::max<std::streamsize> (stream_a.in_avail (), 0);
+		hashes_m.reserve (std::min<std::size_t> (available / sizeof (nano::block_hash), max_hashes));
+		while (stream_a.in_avail () > 0 && hashes_m.size () < max_hashes)
 		{
 			nano::block_hash block_hash;
 			nano::read (stream_a, block_hash);
-			hashes.push_back (block_hash);
+			hashes_m.push_back (block_hash);
 		}
+		hash_m = compute_hash ();
 	}
 	catch (std::runtime_error const &)
 	{
@@ -63,13 +72,18 @@ std::size_t nano::vote::size (uint8_t count)
 
 std::string const nano::vote::hash_prefix = "vote ";
 
-nano::block_hash nano::vote::hash () const
+nano::block_hash const & nano::vote::hash () const
+{
+	return hash_m;
+}
+
+nano::block_hash nano::vote::compute_hash () const
 {
 	nano::block_hash result;
 	blake2b_state hash;
 	blake2b_init (&hash, sizeof (result.bytes));
 	blake2b_update (&hash, hash_prefix.data (), hash_prefix.size ());
-	for (auto const & block_hash : hashes)
+	for (auto const & block_hash : hashes_m)
 	{
 		blake2b_update (&hash, block_hash.bytes.data (), sizeof (block_hash.bytes));
 	}
@@ -103,7 +117,7 @@ bool nano::vote::validate () const
 
 bool nano::vote::operator== (nano::vote const & other_a) const
 {
-	return timestamp_m == other_a.timestamp_m && hashes == other_a.hashes && account == other_a.account && signature == other_a.signature;
+	return timestamp_m == other_a.timestamp_m && hashes_m == other_a.hashes_m && account == other_a.account && signature == other_a.signature;
 }
 
 bool nano::vote::operator!= (nano::vote const & other_a) const
@@ -115,6 +129,11 @@ bool nano::vote::operator!= (nano::vote const & other_a) const
  * Returns the timestamp of the vote (with the duration bits masked, set to zero)
  * If it is a final vote, all the bits including duration bits are returned as they are, all FF
  */
+nano::vote::hashes_t const & nano::vote::hashes () const
+{
+	return hashes_m;
+}
+
 uint64_t nano::vote::timestamp () const
 {
 	return (timestamp_m == std::numeric_limits<uint64_t>::max ())
@@ -150,7 +169,7 @@ void nano::vote::serialize_json (boost::property_tree::ptree & tree) const
 	tree.put ("timestamp", std::to_string (timestamp ()));
 	tree.put ("duration", std::to_string (duration_bits ()));
 	boost::property_tree::ptree blocks_tree;
-	for (auto const & hash : hashes)
+	for (auto const & hash : hashes_m)
 	{
 		boost::property_tree::ptree entry;
 		entry.put ("", hash.to_string ());
@@ -170,7 +189,7 @@ std::string nano::vote::to_json () const
 
 std::string nano::vote::hashes_string () const
 {
-	return nano::util::join (hashes, ", ", [] (auto const & hash) {
+	return nano::util::join (hashes_m, ", ", [] (auto const & hash) {
 		return hash.to_string ();
 	});
 }
@@ -192,5 +211,5 @@ void nano::vote::operator() (nano::object_stream & obs) const
 	obs.write ("account", account);
 	obs.write ("final", is_final_timestamp (timestamp_m));
 	obs.write ("timestamp", timestamp_m);
-	obs.write_range ("hashes", hashes);
+	obs.write_range ("hashes", hashes_m);
 }
\ No newline at end of file
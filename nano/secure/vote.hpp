@@ -5,6 +5,7 @@
 #include <nano/lib/timer.hpp>
 #include <nano/lib/uniquer.hpp>
 
+#include <boost/container/small_vector.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/property_tree/ptree_fwd.hpp>
 
@@ -20,7 +21,7 @@ namespace nano
 class vote final
 {
 public:
-	vote () = default;
+	vote ();
 	vote (nano::vote const &) = default;
 	vote (bool & error, nano::stream &);
 	vote (nano::account const &, nano::raw_key const &, nano::millis_t timestamp, uint8_t duration, std::vector<nano::block_hash> const & hashes);
@@ -33,7 +34,8 @@ public:
 	bool deserialize (nano::stream &);
 	static std::size_t size (uint8_t count);
 
-	nano::block_hash hash () const;
+	/** Hash of the signed payload, computed once when the vote is created or deserialized */
+	nano::block_hash const & hash () const;
 	nano::block_hash full_hash () const;
 	bool validate () const;
 
@@ -55,13 +57,17 @@ public:
 	static uint8_t constexpr duration_max = { 0x0fu };
 
 	static std::size_t constexpr max_hashes = 255;
+	/** Votes with up to this many hashes keep them inline, larger votes allocate a separate buffer */
+	static std::size_t constexpr inline_hashes = 4;
+	using hashes_t = boost::container::small_vector<nano::block_hash, inline_hashes>;
+
+	/** Hashes covered by this vote, they cannot change after construction as the vote hash is cached */
+	hashes_t const & hashes () const;
 
 	/* Check if timestamp represents a final vote */
 	static bool is_final_timestamp (uint64_t timestamp);
 
 public: // Payload
-	// The hashes for which this vote directly covers
-	std::vector<nano::block_hash> hashes;
 	// Account that's voting
 	nano::account account{ 0 };
 	// Signature of timestamp + block hashes
@@ -70,8 +76,14 @@ public: // Payload
 private: // Payload
 	// Vote timestamp
 	uint64_t timestamp_m{ 0 };
+	// The hashes for which this vote directly covers
+	hashes_t hashes_m;
+
+	nano::block_hash hash_m{ 0 };
 
 private:
+	nano::block_hash compute_hash () const;
+
 	// Size of vote payload without hashes
 	static std::size_t constexpr partial_size = sizeof (account) + sizeof (signature) + sizeof (timestamp_m);
 	static std::string const hash_prefix;
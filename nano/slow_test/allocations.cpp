@@ -0,0 +1,57 @@
+#include <nano/slow_test/allocations.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<uint64_t> allocations{ 0 };
+std::atomic<uint64_t> bytes{ 0 };
+}
+
+uint64_t nano::test::allocation_count ()
+{
+	return allocations.load ();
+}
+
+uint64_t nano::test::allocated_bytes ()
+{
+	return bytes.load ();
+}
+
+void * operator new (std::size_t size)
+{
+	allocations.fetch_add (1, std::memory_order_relaxed);
+	bytes.fetch_add (size, std::memory_order_relaxed);
+	if (auto result = std::malloc (size == 0 ? 1 : size))
+	{
+		return result;
+	}
+	throw std::bad_alloc{};
+}
+
+void * operator new[] (std::size_t size)
+{
+	return ::operator new (size);
+}
+
+void operator delete (void * ptr) noexcept
+{
+	std::free (ptr);
+}
+
+void operator delete[] (void * ptr) noexcept
+{
+	std::free (ptr);
+}
+
+void operator delete (void * ptr, std::size_t) noexcept
+{
+	std::free (ptr);
+}
+
+void operator delete[] (void * ptr, std::size_t) noexcept
+{
+	std::free (ptr);
+}
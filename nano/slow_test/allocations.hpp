@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace nano::test
+{
+/*
+ * Global allocations made by the slow_test binary, counted by its replacement `operator new`
+ */
+uint64_t allocation_count ();
+uint64_t allocated_bytes ();
+}
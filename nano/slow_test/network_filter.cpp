@@ -0,0 +1,59 @@
+#include <nano/lib/network_filter.hpp>
+#include <nano/lib/timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+/*
+ * Measures digest filtering throughput with an increasing number of threads applying digests concurrently, as IO threads do for inbound messages
+ */
+TEST (network_filter, benchmark_concurrent)
+{
+	std::size_t const filter_size = 256 * 1024;
+	std::size_t const operations = 4 * 1024 * 1024; // Per thread
+
+	// Half of the digests repeat, similar to duplicate publish and confirm_ack traffic
+	std::vector<nano::network_filter::digest_t> digests;
+	std::mt19937_64 rng{ 0 };
+	for (std::size_t i = 0; i < 64 * 1024; ++i)
+	{
+		nano::network_filter::digest_t digest{ rng () };
+		digests.push_back ((digest << 64) | rng ());
+	}
+
+	for (std::size_t thread_count : { 1, 2, 4, 8, 16 })
+	{
+		nano::network_filter filter{ filter_size };
+		std::vector<std::thread> threads;
+		nano::timer<std::chrono::milliseconds> timer{ nano::timer_state::started };
+		for (std::size_t n = 0; n < thread_count; ++n)
+		{
+			threads.emplace_back ([&filter, &digests, n, operations] () {
+				std::mt19937_64 rng{ n };
+				for (std::size_t i = 0; i < operations; ++i)
+				{
+					auto const & digest = digests[rng () % digests.size ()];
+					if (i % 2 == 0)
+					{
+						filter.apply (digest);
+					}
+					else
+					{
+						filter.check (digest);
+					}
+				}
+			});
+		}
+		for (auto & thread : threads)
+		{
+			thread.join ();
+		}
+		auto elapsed = std::max<uint64_t> (timer.since_start ().count (), 1);
+		auto total = operations * thread_count;
+		std::cout << "threads: " << thread_count << ", operations: " << total << ", elapsed: " << elapsed << " ms, operations/sec: " << total * 1000 / elapsed << std::endl;
+	}
+}
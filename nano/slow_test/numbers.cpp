@@ -0,0 +1,111 @@
+#include <nano/crypto_lib/random_pool.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+std::vector<nano::uint128_t> random_amounts (std::size_t count, unsigned bits)
+{
+	std::vector<nano::uint128_t> result;
+	result.reserve (count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		nano::uint128_union number;
+		nano::random_pool::generate_block (number.bytes.data (), number.bytes.size ());
+		result.push_back (number.number () >> (128 - bits));
+	}
+	return result;
+}
+
+/** Sums weights of votes spread over a few blocks, the same way `election::tally_impl` does */
+template <typename Number>
+nano::uint128_t tally (std::vector<Number> const & weights, std::size_t rounds)
+{
+	Number total{ 0 };
+	for (std::size_t round = 0; round < rounds; ++round)
+	{
+		std::unordered_map<nano::block_hash, Number> block_weights;
+		for (std::size_t i = 0; i < weights.size (); ++i)
+		{
+			block_weights[nano::block_hash{ i % 3 }] += weights[i];
+		}
+		total += std::max_element (block_weights.begin (), block_weights.end (), [] (auto const & a, auto const & b) { return a.second < b.second; })->second;
+	}
+	return nano::uint128_t{ total };
+}
+
+/** Finds the bucket of each balance, the same way `scheduler::priority::find_bucket` does */
+template <typename Number>
+std::size_t find_buckets (std::vector<Number> const & minimums, std::vector<Number> const & balances)
+{
+	std::size_t total = 0;
+	for (auto const & balance : balances)
+	{
+		total += std::distance (minimums.begin (), std::upper_bound (minimums.begin (), minimums.end (), balance)) - 1;
+	}
+	return total;
+}
+
+template <typename Number>
+std::vector<Number> convert (std::vector<nano::uint128_t> const & values)
+{
+	std::vector<Number> result;
+	result.reserve (values.size ());
+	std::transform (values.begin (), values.end (), std::back_inserter (result), [] (auto const & value) { return static_cast<Number> (value); });
+	return result;
+}
+}
+
+/*
+ * Compares `nano::uint128_t` against `nano::uint128_native_t` in the vote tally and priority bucket lookup loops
+ */
+TEST (numbers, benchmark_native)
+{
+	// Weights of a few thousand representatives, tallied a thousand times
+	auto const weights = random_amounts (5000, 110);
+	std::size_t const rounds = 1000;
+	// Bucket minimums spread the same way as the election scheduler buckets, with one lookup for each of a million balances
+	std::vector<nano::uint128_t> minimums{ 0 };
+	for (auto i = 79; i < 120; ++i)
+	{
+		minimums.push_back (nano::uint128_t{ 1 } << i);
+	}
+	auto const balances = random_amounts (1000000, 120);
+
+	auto measure = [] (auto && action) {
+		nano::timer<std::chrono::milliseconds> timer{ nano::timer_state::started };
+		auto result = action ();
+		return std::make_pair (result, std::max<uint64_t> (timer.since_start ().count (), 1));
+	};
+
+	auto const [tally_boost, tally_boost_ms] = measure ([&] { return tally (weights, rounds); });
+	auto const weights_native = convert<nano::uint128_native_t> (weights);
+	auto const [tally_native, tally_native_ms] = measure ([&] { return tally (weights_native, rounds); });
+	ASSERT_EQ (tally_boost, tally_native);
+	std::cout << "tally: uint128_t " << tally_boost_ms << " ms, uint128_native_t " << tally_native_ms << " ms" << std::endl;
+
+	// Balances are read from account info and block amounts, which store them as `nano::amount`
+	std::vector<nano::amount> amounts{ balances.begin (), balances.end () };
+	auto const [buckets_boost, buckets_boost_ms] = measure ([&] {
+		std::vector<nano::uint128_t> balances_l;
+		balances_l.reserve (amounts.size ());
+		std::transform (amounts.begin (), amounts.end (), std::back_inserter (balances_l), [] (auto const & amount) { return amount.number (); });
+		return find_buckets (minimums, balances_l);
+	});
+	auto const minimums_native = convert<nano::uint128_native_t> (minimums);
+	auto const [buckets_native, buckets_native_ms] = measure ([&] {
+		std::vector<nano::uint128_native_t> balances_l;
+		balances_l.reserve (amounts.size ());
+		std::transform (amounts.begin (), amounts.end (), std::back_inserter (balances_l), [] (auto const & amount) { return amount.number_native (); });
+		return find_buckets (minimums_native, balances_l);
+	});
+	ASSERT_EQ (buckets_boost, buckets_native);
+	std::cout << "bucket lookup: uint128_t " << buckets_boost_ms << " ms, uint128_native_t " << buckets_native_ms << " ms" << std::endl;
+}
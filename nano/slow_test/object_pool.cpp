@@ -0,0 +1,85 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/memory.hpp>
+#include <nano/lib/object_pool.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/lib/timer.hpp>
+#include <nano/node/messages.hpp>
+#include <nano/secure/common.hpp>
+#include <nano/secure/vote.hpp>
+#include <nano/slow_test/allocations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+template <typename Tag>
+uint64_t pool_misses ()
+{
+	return nano::object_pool_stats<Tag>::misses.load ();
+}
+
+uint64_t total_misses ()
+{
+	return pool_misses<nano::publish> () + pool_misses<nano::confirm_ack> () + pool_misses<nano::vote> () + pool_misses<nano::state_block> ();
+}
+
+template <typename Message>
+void deserialize (std::vector<uint8_t> const & bytes)
+{
+	nano::bufferstream stream{ bytes.data (), bytes.size () };
+	bool error = false;
+	nano::message_header header{ error, stream };
+	debug_assert (!error);
+	auto message = std::make_unique<Message> (error, stream, header);
+	debug_assert (!error);
+}
+}
+
+/*
+ * Counts global allocations while deserializing 100k publish and 100k confirm_ack messages with memory pools disabled and enabled,
+ * next to the allocations of pooled objects (messages, votes and state blocks) which missed their pool
+ */
+TEST (object_pool, benchmark_deserialize)
+{
+	std::size_t const count = 100000;
+
+	nano::block_builder builder;
+	nano::keypair key;
+	auto block = builder.state ().account (key.pub).previous (1).representative (key.pub).balance (2).link (3).sign (key.prv, key.pub).work (4).build ();
+	nano::publish publish{ nano::dev::network_params.network, block };
+	std::vector<nano::block_hash> hashes;
+	for (auto i = 0; i < 12; ++i)
+	{
+		hashes.push_back (i + 1);
+	}
+	auto vote = std::make_shared<nano::vote> (key.pub, key.prv, 0, 0, hashes);
+	nano::confirm_ack confirm_ack{ nano::dev::network_params.network, vote };
+	auto publish_bytes = publish.to_bytes ();
+	auto confirm_ack_bytes = confirm_ack.to_bytes ();
+
+	auto const use_memory_pools = nano::get_use_memory_pools ();
+	for (auto enabled : { false, true })
+	{
+		nano::set_use_memory_pools (enabled);
+		auto const misses = total_misses ();
+		auto const allocations = nano::test::allocation_count ();
+		nano::timer<std::chrono::milliseconds> timer{ nano::timer_state::started };
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			deserialize<nano::publish> (*publish_bytes);
+			deserialize<nano::confirm_ack> (*confirm_ack_bytes);
+		}
+		auto elapsed = timer.since_start ().count ();
+		// Includes allocations outside of the pools, such as the hash buffer of votes with more than `nano::vote::inline_hashes` hashes
+		std::cout << "pools: " << (enabled ? "enabled" : "disabled") << ", messages: " << count * 2 << ", allocations: " << nano::test::allocation_count () - allocations << ", pool misses: " << total_misses () - misses << ", elapsed: " << elapsed << " ms" << std::endl;
+		if (enabled && nano::get_use_memory_pools ())
+		{
+			// After warming up, objects are recycled through the thread cache
+			ASSERT_LT (total_misses () - misses, count / 100);
+		}
+	}
+	nano::set_use_memory_pools (use_memory_pools);
+}
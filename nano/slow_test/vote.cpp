@@ -0,0 +1,147 @@
+#include <nano/lib/stream.hpp>
+#include <nano/lib/timer.hpp>
+#include <nano/secure/common.hpp>
+#include <nano/secure/vote.hpp>
+#include <nano/slow_test/allocations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+/** Vote layout before hashes were kept inline and the vote hash was cached, deserialized and hashed the same way it used to be */
+class legacy_vote
+{
+public:
+	legacy_vote (bool & error, nano::stream & stream)
+	{
+		try
+		{
+			nano::read (stream, account.bytes);
+			nano::read (stream, signature.bytes);
+			nano::read (stream, timestamp);
+			auto const available = std::max<std::streamsize> (stream.in_avail (), 0);
+			hashes.reserve (std::min<std::size_t> (available / sizeof (nano::block_hash), nano::vote::max_hashes));
+			while (stream.in_avail () > 0 && hashes.size () < nano::vote::max_hashes)
+			{
+				nano::block_hash block_hash;
+				nano::read (stream, block_hash);
+				hashes.push_back (block_hash);
+			}
+			error = false;
+		}
+		catch (std::runtime_error const &)
+		{
+			error = true;
+		}
+	}
+
+	nano::block_hash hash () const
+	{
+		static std::string const prefix = "vote ";
+		nano::block_hash result;
+		blake2b_state state;
+		blake2b_init (&state, sizeof (result.bytes));
+		blake2b_update (&state, prefix.data (), prefix.size ());
+		for (auto const & block_hash : hashes)
+		{
+			blake2b_update (&state, block_hash.bytes.data (), sizeof (block_hash.bytes));
+		}
+		blake2b_update (&state, &timestamp, sizeof (timestamp));
+		blake2b_final (&state, result.bytes.data (), sizeof (result.bytes));
+		return result;
+	}
+
+	nano::block_hash full_hash () const
+	{
+		nano::block_hash result;
+		blake2b_state state;
+		blake2b_init (&state, sizeof (result.bytes));
+		blake2b_update (&state, hash ().bytes.data (), sizeof (hash ().bytes));
+		blake2b_update (&state, account.bytes.data (), sizeof (account.bytes.data ()));
+		blake2b_update (&state, signature.bytes.data (), sizeof (signature.bytes.data ()));
+		blake2b_final (&state, result.bytes.data (), sizeof (result.bytes));
+		return result;
+	}
+
+	std::vector<nano::block_hash> hashes;
+	nano::account account;
+	nano::signature signature;
+	uint64_t timestamp{ 0 };
+};
+
+struct measurement
+{
+	double allocations; // Per vote
+	double bytes; // Per vote
+	uint64_t votes_per_sec;
+};
+
+/** Deserializes `count` votes of type `Vote` from `bytes`, keeping them all alive, and computes the full hash of each */
+template <typename Vote>
+measurement measure (std::vector<uint8_t> const & bytes, std::size_t count)
+{
+	std::vector<std::shared_ptr<Vote>> votes;
+	votes.reserve (count);
+	auto const allocations = nano::test::allocation_count ();
+	auto const allocated = nano::test::allocated_bytes ();
+	nano::timer<std::chrono::milliseconds> timer{ nano::timer_state::started };
+	uint64_t checksum = 0;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		bool error = false;
+		nano::bufferstream stream{ bytes.data (), bytes.size () };
+		auto vote = std::make_shared<Vote> (error, stream);
+		debug_assert (!error);
+		checksum += vote->full_hash ().qwords[0];
+		votes.push_back (std::move (vote));
+	}
+	auto const elapsed = std::max<uint64_t> (timer.since_start ().count (), 1);
+	release_assert (checksum != 0);
+	return { static_cast<double> (nano::test::allocation_count () - allocations) / count, static_cast<double> (nano::test::allocated_bytes () - allocated) / count, count * 1000 / elapsed };
+}
+}
+
+/*
+ * Measures allocations and memory per vote and deserialization throughput (including the vote hash and full hash) for votes with an increasing number of hashes
+ * Compared against the previous layout, which kept hashes in a separately allocated `std::vector` and did not cache the vote hash
+ */
+TEST (vote, benchmark_memory)
+{
+	std::size_t const count = 100000;
+	nano::keypair key;
+
+	for (std::size_t hash_count : { 1, 2, 4, 8, 12, 32, 255 })
+	{
+		std::vector<nano::block_hash> hashes;
+		for (std::size_t i = 0; i < hash_count; ++i)
+		{
+			hashes.push_back (i + 1);
+		}
+		nano::vote original{ key.pub, key.prv, nano::vote::timestamp_min, 0, hashes };
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream{ bytes };
+			original.serialize (stream);
+		}
+		{
+			bool error = false;
+			nano::bufferstream stream{ bytes.data (), bytes.size () };
+			legacy_vote legacy{ error, stream };
+			ASSERT_FALSE (error);
+			ASSERT_EQ (original.hash (), legacy.hash ());
+			ASSERT_EQ (original.full_hash (), legacy.full_hash ());
+		}
+
+		auto const previous = measure<legacy_vote> (bytes, count);
+		auto const current = measure<nano::vote> (bytes, count);
+		std::cout << "hashes: " << hash_count
+				  << ", allocations per vote: " << current.allocations << " (previously " << previous.allocations << ")"
+				  << ", bytes per vote: " << current.bytes << " (previously " << previous.bytes << ")"
+				  << ", votes/sec: " << current.votes_per_sec << " (previously " << previous.votes_per_sec << ")" << std::endl;
+		ASSERT_LE (current.allocations, previous.allocations);
+	}
+}
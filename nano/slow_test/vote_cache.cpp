@@ -1,5 +1,6 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/node/active_elections.hpp>
+#include <nano/node/vote_cache.hpp>
 #include <nano/node/vote_router.hpp>
 #include <nano/test_common/rate_observer.hpp>
 #include <nano/test_common/system.hpp>
@@ -9,6 +10,7 @@
 
 #include <functional>
 #include <thread>
+#include <unordered_map>
 
 using namespace std::chrono_literals;
 
@@ -250,3 +252,70 @@ TEST (vote_cache, perf_multithreaded)
 	// Ensure vote cache size is at max capacity
 	ASSERT_EQ (node.vote_cache.size (), config.vote_cache.max_size);
 }
+
+/*
+ * Measures raw vote cache insert throughput and memory used per cached block, without the overhead of vote processing
+ */
+TEST (vote_cache, perf_insert)
+{
+	nano::test::system system;
+	nano::vote_cache_config config;
+	nano::vote_cache vote_cache{ config, system.stats };
+
+	const int rep_count = 64;
+	const int block_count = 1024 * 128; // 2x the default vote cache size
+	const int votes_per_rep = 1024 * 4;
+	const int single_vote_size = 12;
+
+	std::vector<nano::keypair> reps (rep_count);
+	std::unordered_map<nano::account, nano::uint128_t> weights;
+	for (int n = 0; n < rep_count; ++n)
+	{
+		weights[reps[n].pub] = nano::Gxrb_ratio * (n + 1);
+	}
+	vote_cache.rep_weight_query = [&weights] (nano::account const & rep) { return weights[rep]; };
+
+	std::vector<nano::block_hash> blocks (block_count);
+	std::generate (blocks.begin (), blocks.end (), [] () { return nano::test::random_hash (); });
+
+	// Votes are prepared upfront, signing is much slower than inserting
+	std::vector<std::shared_ptr<nano::vote>> votes;
+	int block_idx = 0;
+	for (int n = 0; n < votes_per_rep; ++n)
+	{
+		for (auto const & rep : reps)
+		{
+			std::vector<nano::block_hash> hashes;
+			for (int i = 0; i < single_vote_size; ++i)
+			{
+				block_idx = (block_idx + 1151) % blocks.size ();
+				hashes.push_back (blocks[block_idx]);
+			}
+			votes.push_back (nano::test::make_vote (rep, hashes, n));
+		}
+	}
+
+	std::cout << "preparation done" << std::endl;
+
+	auto const start = std::chrono::steady_clock::now ();
+	for (auto const & vote : votes)
+	{
+		vote_cache.insert (vote);
+	}
+	auto const elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (std::chrono::steady_clock::now () - start);
+
+	auto const inserts = votes.size () * single_vote_size;
+	std::cout << "inserts: " << inserts << " in " << elapsed.count () << "s, " << static_cast<uint64_t> (inserts / elapsed.count ()) << " inserts/sec" << std::endl;
+
+	// Sum up memory reported by all container info leaves
+	std::size_t memory = 0;
+	auto info = vote_cache.collect_container_info ("vote_cache");
+	for (auto const & child : static_cast<nano::container_info_composite &> (*info).get_children ())
+	{
+		auto const & leaf = static_cast<nano::container_info_leaf &> (*child).get_info ();
+		memory += leaf.count * leaf.sizeof_element;
+	}
+	std::cout << "entries: " << vote_cache.size () << ", memory: " << memory << " bytes, " << memory / vote_cache.size () << " bytes/entry" << std::endl;
+
+	ASSERT_EQ (vote_cache.size (), config.max_size);
+}
@@ -0,0 +1,56 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/timer.hpp>
+#include <nano/node/vote_generator.hpp>
+#include <nano/node/wallet.hpp>
+#include <nano/test_common/chains.hpp>
+#include <nano/test_common/system.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+using namespace std::chrono_literals;
+
+/*
+ * Measures vote generation throughput for replies to vote requests with an increasing number of signing threads
+ */
+TEST (vote_generator, signing_throughput)
+{
+	unsigned const representatives = 4;
+	int const block_count = 1200; // 100 votes of 12 hashes per representative and round
+	unsigned const rounds = 50;
+
+	for (unsigned threads : { 1u, 2u, 4u, 8u })
+	{
+		nano::test::system system;
+		auto config = system.default_config ();
+		config.vote_generator_threads = threads;
+		config.backlog_population.enable = false;
+		auto & node = *system.add_node (config);
+
+		auto wallet = system.wallet (0);
+		wallet->insert_adhoc (nano::dev::genesis_key.prv);
+		for (unsigned i = 1; i < representatives; ++i)
+		{
+			auto rep = nano::test::setup_rep (system, node, node.config.vote_minimum.number () * 10);
+			wallet->insert_adhoc (rep.prv);
+		}
+		node.wallets.compute_reps ();
+		ASSERT_TIMELY_EQ (5s, node.wallets.reps ().voting, representatives);
+
+		auto blocks = nano::test::setup_independent_blocks (system, node, block_count);
+		auto channel = nano::test::fake_channel (node);
+
+		uint64_t const expected = rounds * (block_count / nano::network::confirm_ack_hashes_max) * representatives;
+		nano::timer<std::chrono::milliseconds> timer{ nano::timer_state::started };
+		for (unsigned i = 0; i < rounds; ++i)
+		{
+			ASSERT_EQ (block_count, node.generator.generate (blocks, channel));
+		}
+		ASSERT_TIMELY (120s, node.stats.count (nano::stat::type::requests, nano::stat::detail::requests_generated_votes, nano::stat::dir::in) >= expected);
+		auto elapsed = std::max<uint64_t> (timer.since_start ().count (), 1);
+
+		std::cout << "threads: " << threads << ", votes: " << expected << ", elapsed: " << elapsed << " ms, votes/sec: " << expected * 1000 / elapsed << std::endl;
+	}
+}
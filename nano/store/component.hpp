@@ -12,7 +12,11 @@
 #include <boost/endian/conversion.hpp>
 #include <boost/polymorphic_cast.hpp>
 
+#include <filesystem>
+#include <functional>
+#include <span>
 #include <stack>
+#include <vector>
 
 namespace nano
 {
@@ -21,11 +25,13 @@ namespace store
 	class account;
 	class block;
 	class confirmation_height;
+	class counters;
 	class final_vote;
 	class online_weight;
 	class peer;
 	class pending;
 	class pruned;
+	class unconfirmed;
 	class version;
 	class rep_weight;
 }
@@ -33,6 +39,25 @@ class ledger_cache;
 
 namespace store
 {
+	/**
+	 * Appends raw entries to an empty table, see `component::bulk_load`
+	 */
+	class bulk_loader
+	{
+	public:
+		virtual ~bulk_loader () = default;
+		/**
+		 * Entries must be added in strictly ascending key order
+		 * @return true on error
+		 */
+		virtual bool put (std::span<uint8_t const> key, std::span<uint8_t const> value) = 0;
+		/**
+		 * Makes all added entries durable and visible
+		 * @return true on error
+		 */
+		virtual bool finish () = 0;
+	};
+
 	/**
 	 * Store manager
 	 */
@@ -54,6 +79,8 @@ namespace store
 		nano::store::final_vote &,
 		nano::store::version &,
 		nano::store::rep_weight &,
+		nano::store::counters &,
+		nano::store::unconfirmed &,
 		bool use_noops_a
 	);
 		// clang-format on
@@ -71,7 +98,7 @@ namespace store
 		store::pending & pending;
 		store::rep_weight & rep_weight;
 		static int constexpr version_minimum{ 21 };
-		static int constexpr version_current{ 24 };
+		static int constexpr version_current{ 25 };
 
 	public:
 		store::online_weight & online_weight;
@@ -80,6 +107,8 @@ namespace store
 		store::confirmation_height & confirmation_height;
 		store::final_vote & final_vote;
 		store::version & version;
+		store::counters & counters;
+		store::unconfirmed & unconfirmed;
 
 	public: // TODO: Shouldn't be public
 		store::write_queue write_queue;
@@ -103,6 +132,32 @@ namespace store
 		virtual read_transaction tx_begin_read () const = 0;
 
 		virtual std::string vendor_get () const = 0;
+
+	public: // Raw access to serialized entries, used for snapshots
+		using raw_visitor = std::function<bool (std::span<uint8_t const> key, std::span<uint8_t const> value)>;
+
+		/**
+		 * Visits entries of a table in ascending key order, from the first key not less than `start` up to but excluding the first key not less than `end`
+		 * Empty `start` or `end` stand for the beginning and the end of the table. Iteration stops early when the visitor returns false.
+		 */
+		virtual void raw_for_each (store::transaction const &, tables, std::span<uint8_t const> start, std::span<uint8_t const> end, raw_visitor const &) const = 0;
+
+		/**
+		 * Creates a loader which fills an empty table, bypassing regular write transactions where the backend allows it
+		 */
+		virtual std::unique_ptr<bulk_loader> bulk_load (tables) = 0;
+
+		/**
+		 * Creates a loader which writes entries of a table into the external `file` instead, the file is added to the table later with `ingest`
+		 * Loaders for separate key ranges of a table can be filled concurrently. Returns nullptr if the backend cannot ingest external files
+		 */
+		virtual std::unique_ptr<bulk_loader> ingest_writer (tables, std::filesystem::path const & file) = 0;
+
+		/**
+		 * Adds files written by `ingest_writer` loaders to a table, bypassing regular write transactions. Key ranges of the files must not overlap
+		 * @return true on error
+		 */
+		virtual bool ingest (tables, std::vector<std::filesystem::path> const & files) = 0;
 	};
 } // namespace store
 } // namespace nano
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/store/component.hpp>
+
+#include <optional>
+
+namespace nano::store
+{
+/**
+ * Aggregate ledger counts, kept in sync with the ledger so they do not need to be recomputed with full table scans at startup
+ */
+class ledger_counts
+{
+public:
+	uint64_t block_count{ 0 };
+	uint64_t account_count{ 0 };
+	uint64_t cemented_count{ 0 };
+
+	bool operator== (ledger_counts const &) const = default;
+};
+
+/**
+ * Manages persisted ledger counters, stored in the meta table
+ */
+class counters
+{
+public:
+	virtual void put (store::write_transaction const &, nano::store::ledger_counts const &) = 0;
+	virtual std::optional<nano::store::ledger_counts> get (store::transaction const &) const = 0;
+	virtual void del (store::write_transaction const &) = 0;
+};
+} // namespace nano::store
@@ -0,0 +1,40 @@
+#include <nano/store/lmdb/counters.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
+
+namespace
+{
+// Key 1 is used by the version store
+nano::uint256_union const counters_key{ 2 };
+}
+
+nano::store::lmdb::counters::counters (nano::store::lmdb::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::lmdb::counters::put (store::write_transaction const & transaction_a, nano::store::ledger_counts const & counts_a)
+{
+	nano::uint256_union value;
+	value.qwords[0] = counts_a.block_count;
+	value.qwords[1] = counts_a.account_count;
+	value.qwords[2] = counts_a.cemented_count;
+	value.qwords[3] = 0;
+	auto status = store.put (transaction_a, tables::meta, counters_key, value);
+	store.release_assert_success (status);
+}
+
+std::optional<nano::store::ledger_counts> nano::store::lmdb::counters::get (store::transaction const & transaction_a) const
+{
+	nano::store::lmdb::db_val data;
+	auto status = store.get (transaction_a, tables::meta, counters_key, data);
+	if (store.success (status))
+	{
+		nano::uint256_union value{ data };
+		return nano::store::ledger_counts{ value.qwords[0], value.qwords[1], value.qwords[2] };
+	}
+	return std::nullopt;
+}
+
+void nano::store::lmdb::counters::del (store::write_transaction const & transaction_a)
+{
+	auto status = store.del (transaction_a, tables::meta, counters_key);
+	store.release_assert_success (status);
+}
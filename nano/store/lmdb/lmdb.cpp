@@ -27,6 +27,8 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 		final_vote_store,
 		version_store,
 		rep_weight_store,
+		counters_store,
+		unconfirmed_store,
 		false // write_queue use_noops
 	},
 	// clang-format on
@@ -40,6 +42,8 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 	final_vote_store{ *this },
 	version_store{ *this },
 	rep_weight_store{ *this },
+	counters_store{ *this },
+	unconfirmed_store{ *this },
 	logger{ logger_a },
 	env (error, path_a, nano::store::lmdb::env::options::make ().set_config (lmdb_config_a).set_use_no_mem_init (true)),
 	mdb_txn_tracker (logger_a, txn_tracking_config_a, block_processor_batch_max_time_a),
@@ -207,6 +211,7 @@ void nano::store::lmdb::component::open_databases (bool & error_a, store::transa
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "final_votes", flags, &final_vote_store.final_votes_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "blocks", MDB_CREATE, &block_store.blocks_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "rep_weights", flags, &rep_weight_store.rep_weights_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "unconfirmed", flags, &unconfirmed_store.unconfirmed_handle) != 0;
 }
 
 bool nano::store::lmdb::component::do_upgrades (store::write_transaction & transaction, nano::ledger_constants & constants, bool & needs_vacuuming)
@@ -230,6 +235,9 @@ bool nano::store::lmdb::component::do_upgrades (store::write_transaction & trans
 			upgrade_v23_to_v24 (transaction);
 			[[fallthrough]];
 		case 24:
+			upgrade_v24_to_v25 (transaction);
+			[[fallthrough]];
+		case 25:
 			break;
 		default:
 			logger.critical (nano::log::type::lmdb, "The version of the ledger ({}) is too high for this node", version_l);
@@ -321,6 +329,48 @@ void nano::store::lmdb::component::upgrade_v23_to_v24 (store::write_transaction
 	logger.info (nano::log::type::lmdb, "Upgrading database from v23 to v24 completed");
 }
 
+// Fill unconfirmed table with all accounts that have blocks above their confirmation height
+void nano::store::lmdb::component::upgrade_v24_to_v25 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::lmdb, "Upgrading database from v24 to v25...");
+
+	drop (transaction, tables::unconfirmed);
+	transaction.refresh ();
+
+	// TODO: Make this smaller in dev builds
+	const size_t batch_size = 250000;
+
+	size_t processed = 0;
+	size_t unconfirmed_count = 0;
+	{
+		auto read_transaction = tx_begin_read ();
+		for (auto it = account.begin (read_transaction), end = account.end (); it != end; ++it)
+		{
+			auto const & [account_l, info] = *it;
+			nano::confirmation_height_info conf_info;
+			confirmation_height.get (read_transaction, account_l, conf_info);
+			if (conf_info.height < info.block_count)
+			{
+				auto status = put (transaction, tables::unconfirmed, account_l, nullptr);
+				release_assert_success (status);
+				++unconfirmed_count;
+			}
+
+			processed++;
+			if (processed % batch_size == 0)
+			{
+				logger.info (nano::log::type::lmdb, "Processed {} accounts", processed);
+				transaction.refresh (); // Refresh to prevent excessive memory usage
+			}
+		}
+	}
+
+	logger.info (nano::log::type::lmdb, "Done processing {} accounts, {} unconfirmed", processed, unconfirmed_count);
+	version.put (transaction, 25);
+
+	logger.info (nano::log::type::lmdb, "Upgrading database from v24 to v25 completed");
+}
+
 /** Takes a filepath, appends '_backup_<timestamp>' to the end (but before any extension) and saves that file in the same directory */
 void nano::store::lmdb::component::create_backup_file (nano::store::lmdb::env & env_a, std::filesystem::path const & filepath_a, nano::logger & logger)
 {
@@ -418,6 +468,8 @@ MDB_dbi nano::store::lmdb::component::table_to_dbi (tables table_a) const
 			return final_vote_store.final_votes_handle;
 		case tables::rep_weights:
 			return rep_weight_store.rep_weights_handle;
+		case tables::unconfirmed:
+			return unconfirmed_store.unconfirmed_handle;
 		default:
 			release_assert (false);
 			return peer_store.peers_handle;
@@ -499,6 +551,94 @@ void nano::store::lmdb::component::rebuild_db (store::write_transaction const &
 	}
 }
 
+void nano::store::lmdb::component::raw_for_each (store::transaction const & transaction_a, tables table_a, std::span<uint8_t const> start_a, std::span<uint8_t const> end_a, raw_visitor const & visitor_a) const
+{
+	auto dbi = table_to_dbi (table_a);
+	MDB_cursor * cursor;
+	release_assert_success (mdb_cursor_open (env.tx (transaction_a), dbi, &cursor));
+
+	MDB_val key{ start_a.size (), const_cast<uint8_t *> (start_a.data ()) };
+	MDB_val value{};
+	MDB_val end{ end_a.size (), const_cast<uint8_t *> (end_a.data ()) };
+	auto status = mdb_cursor_get (cursor, &key, &value, start_a.empty () ? MDB_FIRST : MDB_SET_RANGE);
+	while (status == MDB_SUCCESS)
+	{
+		if (!end_a.empty () && mdb_cmp (env.tx (transaction_a), dbi, &key, &end) >= 0)
+		{
+			break;
+		}
+		if (!visitor_a ({ static_cast<uint8_t const *> (key.mv_data), key.mv_size }, { static_cast<uint8_t const *> (value.mv_data), value.mv_size }))
+		{
+			break;
+		}
+		status = mdb_cursor_get (cursor, &key, &value, MDB_NEXT);
+	}
+	debug_assert (status == MDB_SUCCESS || status == MDB_NOTFOUND);
+	mdb_cursor_close (cursor);
+}
+
+namespace
+{
+/**
+ * Appends entries with MDB_APPEND, which skips the btree search and fills pages sequentially
+ */
+class lmdb_bulk_loader final : public nano::store::bulk_loader
+{
+public:
+	lmdb_bulk_loader (nano::store::lmdb::component & store_a, nano::tables table_a, MDB_dbi dbi_a) :
+		store{ store_a },
+		transaction{ store_a.tx_begin_write ({ table_a }) },
+		dbi{ dbi_a }
+	{
+	}
+
+	bool put (std::span<uint8_t const> key_a, std::span<uint8_t const> value_a) override
+	{
+		MDB_val key{ key_a.size (), const_cast<uint8_t *> (key_a.data ()) };
+		MDB_val value{ value_a.size (), const_cast<uint8_t *> (value_a.data ()) };
+		if (mdb_put (store.env.tx (transaction), dbi, &key, &value, MDB_APPEND) != MDB_SUCCESS)
+		{
+			return true;
+		}
+		if (++count % batch_size == 0)
+		{
+			transaction.commit ();
+			transaction.renew ();
+		}
+		return false;
+	}
+
+	bool finish () override
+	{
+		transaction.commit ();
+		return false;
+	}
+
+private:
+	static std::size_t constexpr batch_size{ 1024 * 1024 };
+
+	nano::store::lmdb::component & store;
+	nano::store::write_transaction transaction;
+	MDB_dbi const dbi;
+	std::size_t count{ 0 };
+};
+}
+
+std::unique_ptr<nano::store::bulk_loader> nano::store::lmdb::component::bulk_load (tables table_a)
+{
+	return std::make_unique<lmdb_bulk_loader> (*this, table_a, table_to_dbi (table_a));
+}
+
+std::unique_ptr<nano::store::bulk_loader> nano::store::lmdb::component::ingest_writer (tables, std::filesystem::path const &)
+{
+	return nullptr;
+}
+
+bool nano::store::lmdb::component::ingest (tables, std::vector<std::filesystem::path> const & files_a)
+{
+	return !files_a.empty ();
+}
+
 bool nano::store::lmdb::component::init_error () const
 {
 	return error;
@@ -9,6 +9,7 @@
 #include <nano/store/lmdb/account.hpp>
 #include <nano/store/lmdb/block.hpp>
 #include <nano/store/lmdb/confirmation_height.hpp>
+#include <nano/store/lmdb/counters.hpp>
 #include <nano/store/lmdb/db_val.hpp>
 #include <nano/store/lmdb/final_vote.hpp>
 #include <nano/store/lmdb/iterator.hpp>
@@ -19,6 +20,7 @@
 #include <nano/store/lmdb/pruned.hpp>
 #include <nano/store/lmdb/rep_weight.hpp>
 #include <nano/store/lmdb/transaction_impl.hpp>
+#include <nano/store/lmdb/unconfirmed.hpp>
 #include <nano/store/lmdb/version.hpp>
 #include <nano/store/versioning.hpp>
 
@@ -50,6 +52,8 @@ private:
 	nano::store::lmdb::pruned pruned_store;
 	nano::store::lmdb::version version_store;
 	nano::store::lmdb::rep_weight rep_weight_store;
+	nano::store::lmdb::counters counters_store;
+	nano::store::lmdb::unconfirmed unconfirmed_store;
 
 	friend class nano::store::lmdb::account;
 	friend class nano::store::lmdb::block;
@@ -61,6 +65,8 @@ private:
 	friend class nano::store::lmdb::pruned;
 	friend class nano::store::lmdb::version;
 	friend class nano::store::lmdb::rep_weight;
+	friend class nano::store::lmdb::counters;
+	friend class nano::store::lmdb::unconfirmed;
 
 public:
 	component (nano::logger &, std::filesystem::path const &, nano::ledger_constants & constants, nano::txn_tracking_config const & txn_tracking_config_a = nano::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), nano::lmdb_config const & lmdb_config_a = nano::lmdb_config{}, bool backup_before_upgrade = false);
@@ -93,6 +99,12 @@ public:
 	bool copy_db (std::filesystem::path const & destination_file) override;
 	void rebuild_db (store::write_transaction const & transaction_a) override;
 
+	void raw_for_each (store::transaction const &, tables, std::span<uint8_t const> start, std::span<uint8_t const> end, raw_visitor const &) const override;
+	std::unique_ptr<store::bulk_loader> bulk_load (tables) override;
+	/** External files cannot be ingested into LMDB, returns nullptr */
+	std::unique_ptr<store::bulk_loader> ingest_writer (tables, std::filesystem::path const & file) override;
+	bool ingest (tables, std::vector<std::filesystem::path> const & files) override;
+
 	template <typename Key, typename Value>
 	store::iterator<Key, Value> make_iterator (store::transaction const & transaction_a, tables table_a, bool const direction_asc = true) const
 	{
@@ -115,6 +127,7 @@ private:
 	void upgrade_v21_to_v22 (store::write_transaction &);
 	void upgrade_v22_to_v23 (store::write_transaction &);
 	void upgrade_v23_to_v24 (store::write_transaction &);
+	void upgrade_v24_to_v25 (store::write_transaction &);
 
 	void open_databases (bool &, store::transaction const &, unsigned);
 
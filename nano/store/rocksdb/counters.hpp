@@ -0,0 +1,22 @@
+#pragma once
+
+#include <nano/store/counters.hpp>
+
+namespace nano::store::rocksdb
+{
+class component;
+}
+namespace nano::store::rocksdb
+{
+class counters : public nano::store::counters
+{
+private:
+	nano::store::rocksdb::component & store;
+
+public:
+	explicit counters (nano::store::rocksdb::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::store::ledger_counts const & counts_a) override;
+	std::optional<nano::store::ledger_counts> get (store::transaction const & transaction_a) const override;
+	void del (store::write_transaction const & transaction_a) override;
+};
+} // namespace nano::store::rocksdb
@@ -48,6 +48,8 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 		final_vote_store,
 		version_store,
 		rep_weight_store,
+		counters_store,
+		unconfirmed_store,
 		!force_use_write_queue // write_queue use_noops
 	},
 	// clang-format on
@@ -61,6 +63,8 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 	final_vote_store{ *this },
 	version_store{ *this },
 	rep_weight_store{ *this },
+	counters_store{ *this },
+	unconfirmed_store{ *this },
 	logger{ logger_a },
 	constants{ constants },
 	rocksdb_config{ rocksdb_config_a },
@@ -172,7 +176,8 @@ std::unordered_map<char const *, nano::tables> nano::store::rocksdb::component::
 		{ "confirmation_height", tables::confirmation_height },
 		{ "pruned", tables::pruned },
 		{ "final_votes", tables::final_votes },
-		{ "rep_weights", tables::rep_weights } };
+		{ "rep_weights", tables::rep_weights },
+		{ "unconfirmed", tables::unconfirmed } };
 
 	debug_assert (map.size () == all_tables ().size () + 1);
 	return map;
@@ -248,6 +253,9 @@ bool nano::store::rocksdb::component::do_upgrades (store::write_transaction & tr
 			upgrade_v23_to_v24 (transaction);
 			[[fallthrough]];
 		case 24:
+			upgrade_v24_to_v25 (transaction);
+			[[fallthrough]];
+		case 25:
 			break;
 		default:
 			logger.critical (nano::log::type::rocksdb, "The version of the ledger ({}) is too high for this node", version_l);
@@ -392,6 +400,73 @@ void nano::store::rocksdb::component::upgrade_v23_to_v24 (store::write_transacti
 	logger.info (nano::log::type::rocksdb, "Upgrading database from v23 to v24 completed");
 }
 
+// Fill unconfirmed table with all accounts that have blocks above their confirmation height
+void nano::store::rocksdb::component::upgrade_v24_to_v25 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v24 to v25...");
+
+	if (column_family_exists ("unconfirmed"))
+	{
+		logger.info (nano::log::type::rocksdb, "Dropping existing unconfirmed table");
+		auto const unconfirmed_handle = get_column_family ("unconfirmed");
+		db->DropColumnFamily (unconfirmed_handle);
+		db->DestroyColumnFamilyHandle (unconfirmed_handle);
+		std::erase_if (handles, [unconfirmed_handle] (auto & handle) {
+			if (handle.get () == unconfirmed_handle)
+			{
+				// The handle resource is deleted by RocksDB.
+				[[maybe_unused]] auto ptr = handle.release ();
+				return true;
+			}
+			return false;
+		});
+		transaction.refresh ();
+	}
+
+	{
+		logger.info (nano::log::type::rocksdb, "Creating table unconfirmed");
+		::rocksdb::ColumnFamilyOptions new_cf_options;
+		::rocksdb::ColumnFamilyHandle * new_cf_handle;
+		::rocksdb::Status status = db->CreateColumnFamily (new_cf_options, "unconfirmed", &new_cf_handle);
+		release_assert (success (status.code ()));
+		handles.emplace_back (new_cf_handle);
+		transaction.refresh ();
+	}
+
+	// TODO: Make this smaller in dev builds
+	const size_t batch_size = 250000;
+
+	size_t processed = 0;
+	size_t unconfirmed_count = 0;
+	{
+		auto read_transaction = tx_begin_read ();
+		for (auto it = account.begin (read_transaction), end = account.end (); it != end; ++it)
+		{
+			auto const & [account_l, info] = *it;
+			nano::confirmation_height_info conf_info;
+			confirmation_height.get (read_transaction, account_l, conf_info);
+			if (conf_info.height < info.block_count)
+			{
+				auto status = put (transaction, tables::unconfirmed, account_l, nullptr);
+				release_assert_success (status);
+				++unconfirmed_count;
+			}
+
+			processed++;
+			if (processed % batch_size == 0)
+			{
+				logger.info (nano::log::type::rocksdb, "Processed {} accounts", processed);
+				transaction.refresh (); // Refresh to prevent excessive memory usage
+			}
+		}
+	}
+
+	logger.info (nano::log::type::rocksdb, "Done processing {} accounts, {} unconfirmed", processed, unconfirmed_count);
+	version.put (transaction, 25);
+
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v24 to v25 completed");
+}
+
 void nano::store::rocksdb::component::generate_tombstone_map ()
 {
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::blocks), std::forward_as_tuple (0, 25000));
@@ -525,6 +600,8 @@ rocksdb::ColumnFamilyHandle * nano::store::rocksdb::component::table_to_column_f
 			return get_column_family ("final_votes");
 		case tables::rep_weights:
 			return get_column_family ("rep_weights");
+		case tables::unconfirmed:
+			return get_column_family ("unconfirmed");
 		default:
 			release_assert (false);
 			return get_column_family ("");
@@ -690,6 +767,14 @@ uint64_t nano::store::rocksdb::component::count (store::transaction const & tran
 			++sum;
 		}
 	}
+	// Entries are deleted as accounts get confirmed, so key estimates are unreliable. Only used in tests and CLI commands.
+	else if (table_a == tables::unconfirmed)
+	{
+		for (auto i (unconfirmed.begin (transaction_a)), n (unconfirmed.end ()); i != n; ++i)
+		{
+			++sum;
+		}
+	}
 	else
 	{
 		debug_assert (false);
@@ -807,7 +892,194 @@ void nano::store::rocksdb::component::on_flush (::rocksdb::FlushJobInfo const &
 
 std::vector<nano::tables> nano::store::rocksdb::component::all_tables () const
 {
-	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote, tables::rep_weights };
+	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote, tables::rep_weights, tables::unconfirmed };
+}
+
+bool nano::store::rocksdb::component::ingest (tables table_a, std::vector<std::filesystem::path> const & files_a)
+{
+	std::vector<std::string> files;
+	for (auto const & file : files_a)
+	{
+		if (std::filesystem::exists (file))
+		{
+			files.push_back (file.string ());
+		}
+	}
+	if (files.empty ())
+	{
+		return false;
+	}
+
+	::rocksdb::IngestExternalFileOptions options;
+	// Files are temporary, hard link them into the database directory instead of copying when possible
+	options.move_files = true;
+	// Entries are written by a single migration process, sequence numbers of existing data are irrelevant
+	options.allow_global_seqno = true;
+	options.allow_blocking_flush = true;
+	options.verify_checksums_before_ingest = true;
+	auto status = db->IngestExternalFile (table_to_column_family (table_a), files, options);
+	if (!status.ok ())
+	{
+		logger.error (nano::log::type::rocksdb, "Unable to ingest {} SST files: {}", files.size (), status.ToString ());
+	}
+	return !status.ok ();
+}
+
+void nano::store::rocksdb::component::raw_for_each (store::transaction const & transaction_a, tables table_a, std::span<uint8_t const> start_a, std::span<uint8_t const> end_a, raw_visitor const & visitor_a) const
+{
+	std::unique_ptr<::rocksdb::Iterator> cursor;
+	if (is_read (transaction_a))
+	{
+		auto read_options = snapshot_options (transaction_a);
+		read_options.fill_cache = false;
+		cursor.reset (db->NewIterator (read_options, table_to_column_family (table_a)));
+	}
+	else
+	{
+		::rocksdb::ReadOptions read_options;
+		read_options.fill_cache = false;
+		cursor.reset (tx (transaction_a)->GetIterator (read_options, table_to_column_family (table_a)));
+	}
+
+	::rocksdb::Slice const start{ reinterpret_cast<char const *> (start_a.data ()), start_a.size () };
+	::rocksdb::Slice const end{ reinterpret_cast<char const *> (end_a.data ()), end_a.size () };
+	if (start_a.empty ())
+	{
+		cursor->SeekToFirst ();
+	}
+	else
+	{
+		cursor->Seek (start);
+	}
+	for (; cursor->Valid (); cursor->Next ())
+	{
+		auto key = cursor->key ();
+		if (!end_a.empty () && key.compare (end) >= 0)
+		{
+			break;
+		}
+		auto value = cursor->value ();
+		if (!visitor_a ({ reinterpret_cast<uint8_t const *> (key.data ()), key.size () }, { reinterpret_cast<uint8_t const *> (value.data ()), value.size () }))
+		{
+			break;
+		}
+	}
+}
+
+namespace
+{
+/**
+ * Writes entries into SST files which are ingested into the column family once finished
+ */
+class rocksdb_bulk_loader final : public nano::store::bulk_loader
+{
+public:
+	rocksdb_bulk_loader (nano::store::rocksdb::component & store_a, nano::tables table_a, std::filesystem::path directory_a) :
+		store{ store_a },
+		table{ table_a },
+		directory{ std::move (directory_a) }
+	{
+		std::filesystem::remove_all (directory);
+		std::filesystem::create_directories (directory);
+	}
+
+	~rocksdb_bulk_loader () override
+	{
+		std::error_code ec;
+		std::filesystem::remove_all (directory, ec);
+	}
+
+	bool put (std::span<uint8_t const> key_a, std::span<uint8_t const> value_a) override
+	{
+		if (writer == nullptr || writer->count () >= file_entries)
+		{
+			if (rotate ())
+			{
+				return true;
+			}
+		}
+		::rocksdb::Slice const key{ reinterpret_cast<char const *> (key_a.data ()), key_a.size () };
+		::rocksdb::Slice const value{ reinterpret_cast<char const *> (value_a.data ()), value_a.size () };
+		return writer->put (key, value);
+	}
+
+	bool finish () override
+	{
+		return rotate () || store.ingest (table, files);
+	}
+
+private:
+	/** Finishes the current file, if any, and starts a new one */
+	bool rotate ()
+	{
+		if (writer != nullptr)
+		{
+			if (writer->finish ())
+			{
+				return true;
+			}
+			if (writer->count () > 0)
+			{
+				files.push_back (writer->file);
+			}
+		}
+		writer = std::make_unique<nano::store::rocksdb::sst_writer> (store, table, directory / (std::to_string (files.size ()) + ".sst"));
+		return false;
+	}
+
+	static std::size_t constexpr file_entries{ 4 * 1024 * 1024 };
+
+	nano::store::rocksdb::component & store;
+	nano::tables const table;
+	std::filesystem::path const directory;
+	std::unique_ptr<nano::store::rocksdb::sst_writer> writer;
+	std::vector<std::filesystem::path> files;
+};
+
+/**
+ * Writes entries into a single SST file which is left for `component::ingest`, the file is removed when no entries were added
+ */
+class rocksdb_ingest_writer final : public nano::store::bulk_loader
+{
+public:
+	rocksdb_ingest_writer (nano::store::rocksdb::component & store_a, nano::tables table_a, std::filesystem::path const & file_a) :
+		writer{ std::make_unique<nano::store::rocksdb::sst_writer> (store_a, table_a, file_a) }
+	{
+	}
+
+	bool put (std::span<uint8_t const> key_a, std::span<uint8_t const> value_a) override
+	{
+		::rocksdb::Slice const key{ reinterpret_cast<char const *> (key_a.data ()), key_a.size () };
+		::rocksdb::Slice const value{ reinterpret_cast<char const *> (value_a.data ()), value_a.size () };
+		return writer->put (key, value);
+	}
+
+	bool finish () override
+	{
+		auto error = writer->finish ();
+		if (!error && writer->count () == 0)
+		{
+			auto file = writer->file;
+			writer.reset ();
+			std::error_code ec;
+			std::filesystem::remove (file, ec);
+		}
+		return error;
+	}
+
+private:
+	std::unique_ptr<nano::store::rocksdb::sst_writer> writer;
+};
+}
+
+std::unique_ptr<nano::store::bulk_loader> nano::store::rocksdb::component::bulk_load (tables table_a)
+{
+	return std::make_unique<rocksdb_bulk_loader> (*this, table_a, std::filesystem::path{ db->GetName () } / "bulk_load");
+}
+
+std::unique_ptr<nano::store::bulk_loader> nano::store::rocksdb::component::ingest_writer (tables table_a, std::filesystem::path const & file_a)
+{
+	return std::make_unique<rocksdb_ingest_writer> (*this, table_a, file_a);
 }
 
 bool nano::store::rocksdb::component::copy_db (std::filesystem::path const & destination_path)
@@ -8,6 +8,7 @@
 #include <nano/store/rocksdb/account.hpp>
 #include <nano/store/rocksdb/block.hpp>
 #include <nano/store/rocksdb/confirmation_height.hpp>
+#include <nano/store/rocksdb/counters.hpp>
 #include <nano/store/rocksdb/final_vote.hpp>
 #include <nano/store/rocksdb/iterator.hpp>
 #include <nano/store/rocksdb/online_weight.hpp>
@@ -15,6 +16,8 @@
 #include <nano/store/rocksdb/pending.hpp>
 #include <nano/store/rocksdb/pruned.hpp>
 #include <nano/store/rocksdb/rep_weight.hpp>
+#include <nano/store/rocksdb/sst_writer.hpp>
+#include <nano/store/rocksdb/unconfirmed.hpp>
 #include <nano/store/rocksdb/version.hpp>
 
 #include <rocksdb/db.h>
@@ -51,6 +54,8 @@ private:
 	nano::store::rocksdb::pruned pruned_store;
 	nano::store::rocksdb::version version_store;
 	nano::store::rocksdb::rep_weight rep_weight_store;
+	nano::store::rocksdb::counters counters_store;
+	nano::store::rocksdb::unconfirmed unconfirmed_store;
 
 public:
 	friend class nano::store::rocksdb::account;
@@ -63,6 +68,9 @@ public:
 	friend class nano::store::rocksdb::pruned;
 	friend class nano::store::rocksdb::version;
 	friend class nano::store::rocksdb::rep_weight;
+	friend class nano::store::rocksdb::counters;
+	friend class nano::store::rocksdb::unconfirmed;
+	friend class nano::store::rocksdb::sst_writer;
 
 	explicit component (nano::logger &, std::filesystem::path const &, nano::ledger_constants & constants, nano::rocksdb_config const & = nano::rocksdb_config{}, bool open_read_only = false, bool force_use_write_queue = false);
 
@@ -83,6 +91,16 @@ public:
 	bool copy_db (std::filesystem::path const & destination) override;
 	void rebuild_db (store::write_transaction const & transaction_a) override;
 
+	void raw_for_each (store::transaction const &, tables, std::span<uint8_t const> start, std::span<uint8_t const> end, raw_visitor const &) const override;
+	std::unique_ptr<store::bulk_loader> bulk_load (tables) override;
+	std::unique_ptr<store::bulk_loader> ingest_writer (tables, std::filesystem::path const & file) override;
+	/**
+	 * Moves SST files created with `sst_writer` into the table, bypassing the memtable, WAL and write transactions
+	 * Files must have non overlapping key ranges and the table is expected to be empty, so files are placed directly in the bottommost level
+	 * Files which do not exist, such as files of empty ranges, are skipped
+	 */
+	bool ingest (tables, std::vector<std::filesystem::path> const & files) override;
+
 	unsigned max_block_write_batch_num () const override;
 
 	template <typename Key, typename Value>
@@ -151,6 +169,7 @@ private:
 	void upgrade_v21_to_v22 (store::write_transaction &);
 	void upgrade_v22_to_v23 (store::write_transaction &);
 	void upgrade_v23_to_v24 (store::write_transaction &);
+	void upgrade_v24_to_v25 (store::write_transaction &);
 
 	void construct_column_family_mutexes ();
 	::rocksdb::Options get_db_options ();
@@ -0,0 +1,60 @@
+#include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/rocksdb/sst_writer.hpp>
+
+#include <rocksdb/sst_file_writer.h>
+
+nano::store::rocksdb::sst_writer::sst_writer (nano::store::rocksdb::component & store_a, nano::tables table_a, std::filesystem::path file_a) :
+	table{ table_a },
+	file{ std::move (file_a) },
+	store{ store_a }
+{
+	auto column_family = store.table_to_column_family (table);
+	// Use the same options as the target column family so ingested files don't need to be rewritten by compaction
+	auto options = store.db->GetOptions (column_family);
+	writer = std::make_unique<::rocksdb::SstFileWriter> (::rocksdb::EnvOptions{}, options, column_family);
+	auto status = writer->Open (file.string ());
+	if (!status.ok ())
+	{
+		store.logger.error (nano::log::type::rocksdb, "Unable to open SST file {}: {}", file.string (), status.ToString ());
+		error = true;
+	}
+}
+
+nano::store::rocksdb::sst_writer::~sst_writer () = default;
+
+bool nano::store::rocksdb::sst_writer::put (nano::store::rocksdb::db_val const & key, nano::store::rocksdb::db_val const & value)
+{
+	if (!error)
+	{
+		auto status = writer->Put (key, value);
+		if (status.ok ())
+		{
+			++entries;
+		}
+		else
+		{
+			store.logger.error (nano::log::type::rocksdb, "Unable to write to SST file {}: {}", file.string (), status.ToString ());
+			error = true;
+		}
+	}
+	return error;
+}
+
+bool nano::store::rocksdb::sst_writer::finish ()
+{
+	if (!error && entries > 0)
+	{
+		auto status = writer->Finish ();
+		if (!status.ok ())
+		{
+			store.logger.error (nano::log::type::rocksdb, "Unable to finish SST file {}: {}", file.string (), status.ToString ());
+			error = true;
+		}
+	}
+	return error;
+}
+
+uint64_t nano::store::rocksdb::sst_writer::count () const
+{
+	return entries;
+}
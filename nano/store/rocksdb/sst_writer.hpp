@@ -0,0 +1,47 @@
+#pragma once
+
+#include <nano/store/rocksdb/db_val.hpp>
+#include <nano/store/tables.hpp>
+
+#include <filesystem>
+#include <memory>
+
+namespace rocksdb
+{
+class SstFileWriter;
+}
+namespace nano::store::rocksdb
+{
+class component;
+}
+namespace nano::store::rocksdb
+{
+/**
+ * Writes entries of a single table into an external SST file which can later be bulk loaded with `component::ingest`.
+ * Entries must be added in strictly increasing key order. Files written for the same table must not have overlapping key ranges.
+ */
+class sst_writer final
+{
+public:
+	sst_writer (nano::store::rocksdb::component &, nano::tables, std::filesystem::path file);
+	~sst_writer ();
+
+	/** @return true on error */
+	bool put (nano::store::rocksdb::db_val const & key, nano::store::rocksdb::db_val const & value);
+	/**
+	 * Flushes the file to disk. Empty files cannot be finished, in that case nothing is written and the file should not be ingested
+	 * @return true on error
+	 */
+	bool finish ();
+	uint64_t count () const;
+
+	nano::tables const table;
+	std::filesystem::path const file;
+
+private:
+	nano::store::rocksdb::component & store;
+	std::unique_ptr<::rocksdb::SstFileWriter> writer;
+	uint64_t entries{ 0 };
+	bool error{ false };
+};
+} // namespace nano::store::rocksdb
@@ -0,0 +1,58 @@
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/rocksdb/unconfirmed.hpp>
+
+nano::store::rocksdb::unconfirmed::unconfirmed (nano::store::rocksdb::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::rocksdb::unconfirmed::put (store::write_transaction const & transaction_a, nano::account const & account_a)
+{
+	auto status = store.put (transaction_a, tables::unconfirmed, account_a, nullptr);
+	store.release_assert_success (status);
+}
+
+void nano::store::rocksdb::unconfirmed::del (store::write_transaction const & transaction_a, nano::account const & account_a)
+{
+	auto status = store.del (transaction_a, tables::unconfirmed, account_a);
+	store.release_assert_success (status);
+}
+
+bool nano::store::rocksdb::unconfirmed::exists (store::transaction const & transaction, nano::account const & account_a) const
+{
+	return store.exists (transaction, tables::unconfirmed, account_a);
+}
+
+size_t nano::store::rocksdb::unconfirmed::count (store::transaction const & transaction_a) const
+{
+	return store.count (transaction_a, tables::unconfirmed);
+}
+
+void nano::store::rocksdb::unconfirmed::clear (store::write_transaction const & transaction_a)
+{
+	auto status = store.drop (transaction_a, tables::unconfirmed);
+	store.release_assert_success (status);
+}
+
+nano::store::iterator<nano::account, std::nullptr_t> nano::store::rocksdb::unconfirmed::begin (store::transaction const & transaction_a, nano::account const & account_a) const
+{
+	return store.make_iterator<nano::account, std::nullptr_t> (transaction_a, tables::unconfirmed, account_a);
+}
+
+nano::store::iterator<nano::account, std::nullptr_t> nano::store::rocksdb::unconfirmed::begin (store::transaction const & transaction_a) const
+{
+	return store.make_iterator<nano::account, std::nullptr_t> (transaction_a, tables::unconfirmed);
+}
+
+nano::store::iterator<nano::account, std::nullptr_t> nano::store::rocksdb::unconfirmed::end () const
+{
+	return store::iterator<nano::account, std::nullptr_t> (nullptr);
+}
+
+void nano::store::rocksdb::unconfirmed::for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::account, std::nullptr_t>, store::iterator<nano::account, std::nullptr_t>)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, start), !is_last ? this->begin (transaction, end) : this->end ());
+	});
+}
@@ -0,0 +1,478 @@
+#include <nano/crypto/blake2/blake2.h>
+#include <nano/lib/locks.hpp>
+#include <nano/lib/logging.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/lib/thread_roles.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/counters.hpp>
+#include <nano/store/snapshot.hpp>
+#include <nano/store/version.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+
+namespace
+{
+std::array<uint8_t, 8> const magic{ 'N', 'A', 'N', 'O', 'S', 'N', 'A', 'P' };
+std::size_t constexpr header_size = magic.size () + sizeof (uint32_t) + sizeof (uint32_t) + sizeof (uint8_t) + 3 * sizeof (uint64_t);
+std::size_t constexpr chunk_header_size = sizeof (uint8_t) + sizeof (uint8_t) + 3 * sizeof (uint32_t) + 8;
+/** Table index of the chunk that terminates the file, its sequence holds the total number of chunks */
+uint8_t constexpr terminator = 0xff;
+
+using checksum_t = std::array<uint8_t, 8>;
+
+checksum_t checksum (std::vector<uint8_t> const & payload)
+{
+	checksum_t result;
+	blake2b_state hash;
+	blake2b_init (&hash, result.size ());
+	blake2b_update (&hash, payload.data (), payload.size ());
+	blake2b_final (&hash, result.data (), result.size ());
+	return result;
+}
+
+void write_varint (std::vector<uint8_t> & out, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		out.push_back (static_cast<uint8_t> (value) | 0x80);
+		value >>= 7;
+	}
+	out.push_back (static_cast<uint8_t> (value));
+}
+
+/** @return true on error */
+bool read_varint (std::span<uint8_t const> & in, uint64_t & value)
+{
+	value = 0;
+	for (unsigned shift = 0; shift < 64 && !in.empty (); shift += 7)
+	{
+		auto byte = in.front ();
+		in = in.subspan (1);
+		value |= static_cast<uint64_t> (byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+struct chunk_header
+{
+	uint8_t table{ 0 };
+	uint8_t range{ 0 };
+	uint32_t sequence{ 0 };
+	uint32_t entries{ 0 };
+	uint32_t size{ 0 };
+	checksum_t checksum{};
+
+	void serialize (nano::stream & stream) const
+	{
+		nano::write (stream, table);
+		nano::write (stream, range);
+		nano::write_big_endian (stream, sequence);
+		nano::write_big_endian (stream, entries);
+		nano::write_big_endian (stream, size);
+		nano::write (stream, checksum);
+	}
+
+	void deserialize (nano::stream & stream)
+	{
+		nano::read (stream, table);
+		nano::read (stream, range);
+		nano::read_big_endian (stream, sequence);
+		nano::read_big_endian (stream, entries);
+		nano::read_big_endian (stream, size);
+		nano::read (stream, checksum);
+	}
+};
+
+/**
+ * Accumulates entries of a single key range, keys are stored as the length shared with the previous key followed by the remaining suffix
+ */
+class chunk_builder
+{
+public:
+	void add (std::span<uint8_t const> key, std::span<uint8_t const> value)
+	{
+		auto shared = std::mismatch (key.begin (), key.end (), previous.begin (), previous.end ()).first - key.begin ();
+		write_varint (payload, shared);
+		write_varint (payload, key.size () - shared);
+		payload.insert (payload.end (), key.begin () + shared, key.end ());
+		write_varint (payload, value.size ());
+		payload.insert (payload.end (), value.begin (), value.end ());
+		previous.assign (key.begin (), key.end ());
+		++entries;
+	}
+
+	void clear ()
+	{
+		payload.clear ();
+		previous.clear ();
+		entries = 0;
+	}
+
+	std::vector<uint8_t> payload;
+	std::vector<uint8_t> previous;
+	uint32_t entries{ 0 };
+};
+
+void write_bytes (std::ofstream & stream, std::vector<uint8_t> const & bytes)
+{
+	stream.write (reinterpret_cast<char const *> (bytes.data ()), bytes.size ());
+}
+
+/**
+ * Decodes the entries of a chunk payload, calling `action` with each key and value
+ * @return true on error
+ */
+template <typename Action>
+bool decode_chunk (std::span<uint8_t const> payload, uint32_t entries, Action && action)
+{
+	std::vector<uint8_t> key;
+	bool error = false;
+	for (uint32_t i = 0; !error && i < entries; ++i)
+	{
+		uint64_t shared, suffix, value;
+		error = read_varint (payload, shared) || read_varint (payload, suffix) || shared > key.size () || suffix > payload.size ();
+		if (!error)
+		{
+			key.resize (shared);
+			key.insert (key.end (), payload.begin (), payload.begin () + suffix);
+			payload = payload.subspan (suffix);
+			error = read_varint (payload, value) || value > payload.size ();
+		}
+		if (!error)
+		{
+			error = action (key, payload.first (value));
+			payload = payload.subspan (value);
+		}
+	}
+	return error || !payload.empty ();
+}
+
+/** @return true on error */
+bool read_bytes (std::ifstream & stream, std::vector<uint8_t> & bytes, std::size_t size)
+{
+	bytes.resize (size);
+	stream.read (reinterpret_cast<char *> (bytes.data ()), size);
+	return static_cast<std::size_t> (stream.gcount ()) != size;
+}
+}
+
+std::vector<nano::tables> const nano::store::snapshot::tables{
+	nano::tables::accounts,
+	nano::tables::blocks,
+	nano::tables::confirmation_height,
+	nano::tables::final_votes,
+	nano::tables::pending,
+	nano::tables::pruned,
+	nano::tables::rep_weights,
+	nano::tables::unconfirmed,
+};
+
+nano::store::snapshot::snapshot (nano::store::component & store_a, nano::logger & logger_a) :
+	store{ store_a },
+	logger{ logger_a }
+{
+}
+
+bool nano::store::snapshot::export_to (std::filesystem::path const & file, unsigned threads)
+{
+	std::ofstream stream{ file, std::ios::binary | std::ios::trunc };
+	if (!stream)
+	{
+		logger.error (nano::log::type::snapshot, "Unable to create snapshot file: {}", file.string ());
+		return true;
+	}
+
+	// Holding a write transaction on the exported tables keeps them unchanged, so every range read below observes the same ledger state
+	auto write_lock = store.tx_begin_write (tables);
+	auto const version = store.version.get (write_lock);
+	auto const counts = store.counters.get (write_lock);
+
+	std::vector<uint8_t> header;
+	{
+		nano::vectorstream header_stream{ header };
+		nano::write (header_stream, magic);
+		nano::write_big_endian (header_stream, format_version);
+		nano::write_big_endian (header_stream, static_cast<uint32_t> (version));
+		nano::write (header_stream, static_cast<uint8_t> (counts.has_value ()));
+		auto const counts_l = counts.value_or (nano::store::ledger_counts{});
+		nano::write_big_endian (header_stream, counts_l.block_count);
+		nano::write_big_endian (header_stream, counts_l.account_count);
+		nano::write_big_endian (header_stream, counts_l.cemented_count);
+	}
+	write_bytes (stream, header);
+
+	logger.info (nano::log::type::snapshot, "Exporting ledger snapshot to: {} (store version: {})", file.string (), version);
+
+	nano::mutex mutex; // Protects the file stream and chunk count
+	uint32_t chunks{ 0 };
+	std::atomic<uint64_t> entries{ 0 };
+	std::atomic<bool> error{ false };
+	std::atomic<std::size_t> next_task{ 0 };
+	auto const task_count = tables.size () * ranges;
+
+	auto flush = [&] (uint8_t table, uint8_t range, uint32_t sequence, chunk_builder const & chunk) {
+		chunk_header chunk_header_l{ table, range, sequence, chunk.entries, static_cast<uint32_t> (chunk.payload.size ()), checksum (chunk.payload) };
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream bytes_stream{ bytes };
+			chunk_header_l.serialize (bytes_stream);
+		}
+
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		write_bytes (stream, bytes);
+		write_bytes (stream, chunk.payload);
+		if (!stream)
+		{
+			return true;
+		}
+		entries += chunk.entries;
+		if (++chunks % 256 == 0)
+		{
+			logger.info (nano::log::type::snapshot, "Exported {} chunks ({} entries)", chunks, entries.load ());
+		}
+		return false;
+	};
+
+	auto worker = [&] () {
+		nano::thread_role::set (nano::thread_role::name::db_parallel_traversal);
+		auto transaction = store.tx_begin_read ();
+		for (auto task = next_task++; task < task_count && !error; task = next_task++)
+		{
+			auto const table = static_cast<uint8_t> (task / ranges);
+			auto const range = static_cast<uint8_t> (task % ranges);
+			// Ranges are split on the first key byte, the first and last range are open ended
+			std::array<uint8_t, 1> const start{ static_cast<uint8_t> (range * (256 / ranges)) };
+			std::array<uint8_t, 1> const end{ static_cast<uint8_t> ((range + 1) * (256 / ranges)) };
+			auto const start_span = range == 0 ? std::span<uint8_t const>{} : std::span<uint8_t const>{ start };
+			auto const end_span = range == ranges - 1 ? std::span<uint8_t const>{} : std::span<uint8_t const>{ end };
+
+			chunk_builder chunk;
+			uint32_t sequence{ 0 };
+			store.raw_for_each (transaction, tables[table], start_span, end_span, [&] (auto key, auto value) {
+				chunk.add (key, value);
+				if (chunk.payload.size () >= chunk_size)
+				{
+					if (flush (table, range, sequence++, chunk))
+					{
+						error = true;
+					}
+					chunk.clear ();
+				}
+				return !error;
+			});
+			if (!error && chunk.entries > 0)
+			{
+				if (flush (table, range, sequence++, chunk))
+				{
+					error = true;
+				}
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (unsigned i = 0; i < std::max (threads, 1u); ++i)
+	{
+		workers.emplace_back (worker);
+	}
+	for (auto & thread : workers)
+	{
+		thread.join ();
+	}
+
+	if (!error)
+	{
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream bytes_stream{ bytes };
+			chunk_header{ terminator, 0, chunks, 0, 0, {} }.serialize (bytes_stream);
+		}
+		write_bytes (stream, bytes);
+		stream.flush ();
+		error = !stream;
+	}
+
+	if (error)
+	{
+		logger.error (nano::log::type::snapshot, "Failed writing snapshot file: {}", file.string ());
+		stream.close ();
+		std::error_code ec;
+		std::filesystem::remove (file, ec);
+		return true;
+	}
+
+	logger.info (nano::log::type::snapshot, "Snapshot export completed: {} chunks, {} entries", chunks, entries.load ());
+	return false;
+}
+
+bool nano::store::snapshot::import_from (std::filesystem::path const & file)
+{
+	std::ifstream stream{ file, std::ios::binary };
+	if (!stream)
+	{
+		logger.error (nano::log::type::snapshot, "Unable to open snapshot file: {}", file.string ());
+		return true;
+	}
+
+	std::vector<uint8_t> bytes;
+	if (read_bytes (stream, bytes, header_size))
+	{
+		logger.error (nano::log::type::snapshot, "Snapshot file is too short: {}", file.string ());
+		return true;
+	}
+
+	std::array<uint8_t, magic.size ()> magic_l;
+	uint32_t format_version_l;
+	uint32_t version;
+	uint8_t has_counts;
+	nano::store::ledger_counts counts;
+	{
+		nano::bufferstream header_stream{ bytes.data (), bytes.size () };
+		nano::read (header_stream, magic_l);
+		nano::read_big_endian (header_stream, format_version_l);
+		nano::read_big_endian (header_stream, version);
+		nano::read (header_stream, has_counts);
+		nano::read_big_endian (header_stream, counts.block_count);
+		nano::read_big_endian (header_stream, counts.account_count);
+		nano::read_big_endian (header_stream, counts.cemented_count);
+	}
+	if (magic_l != magic || format_version_l != format_version)
+	{
+		logger.error (nano::log::type::snapshot, "Not a supported snapshot file: {}", file.string ());
+		return true;
+	}
+
+	{
+		auto transaction = store.tx_begin_read ();
+		auto const store_version = store.version.get (transaction);
+		if (static_cast<int> (version) != store_version)
+		{
+			logger.error (nano::log::type::snapshot, "Snapshot store version {} does not match the store version {}", version, store_version);
+			return true;
+		}
+		for (auto table : tables)
+		{
+			bool empty = true;
+			store.raw_for_each (transaction, table, {}, {}, [&empty] (auto, auto) {
+				empty = false;
+				return false;
+			});
+			if (!empty)
+			{
+				logger.error (nano::log::type::snapshot, "Snapshots can only be imported into an empty ledger");
+				return true;
+			}
+		}
+	}
+
+	// Index chunks first, they are written in completion order and need to be loaded in key order
+	struct indexed_chunk
+	{
+		chunk_header header;
+		std::streamoff offset;
+	};
+	std::vector<indexed_chunk> chunks;
+	std::optional<uint32_t> expected;
+	while (!expected)
+	{
+		chunk_header header;
+		if (read_bytes (stream, bytes, chunk_header_size))
+		{
+			break;
+		}
+		nano::bufferstream header_stream{ bytes.data (), bytes.size () };
+		header.deserialize (header_stream);
+		if (header.table == terminator)
+		{
+			expected = header.sequence;
+		}
+		else if (header.table >= tables.size () || header.range >= ranges)
+		{
+			break;
+		}
+		else
+		{
+			chunks.push_back ({ header, stream.tellg () });
+			stream.seekg (header.size, std::ios::cur);
+		}
+	}
+	if (!expected || *expected != chunks.size ())
+	{
+		logger.error (nano::log::type::snapshot, "Snapshot file is truncated or corrupt: {}", file.string ());
+		return true;
+	}
+
+	std::sort (chunks.begin (), chunks.end (), [] (indexed_chunk const & lhs, indexed_chunk const & rhs) {
+		return std::tie (lhs.header.table, lhs.header.range, lhs.header.sequence) < std::tie (rhs.header.table, rhs.header.range, rhs.header.sequence);
+	});
+
+	auto read_chunk = [&stream, &bytes] (indexed_chunk const & chunk) {
+		stream.clear ();
+		stream.seekg (chunk.offset);
+		return read_bytes (stream, bytes, chunk.header.size) || checksum (bytes) != chunk.header.checksum;
+	};
+
+	// Every chunk is verified before anything is written, tables loaded before a corrupt chunk could not be rolled back and the import could not be retried
+	for (auto current = chunks.begin (); current != chunks.end (); ++current)
+	{
+		auto const & header = current->header;
+		auto const previous = current == chunks.begin () ? nullptr : &std::prev (current)->header;
+		bool const first = previous == nullptr || previous->table != header.table || previous->range != header.range;
+		// A gap or duplicate in the sequence means chunks are missing
+		bool error = header.sequence != (first ? 0 : previous->sequence + 1);
+		error = error || read_chunk (*current) || decode_chunk (bytes, header.entries, [] (auto const &, auto) { return false; });
+		if (error)
+		{
+			logger.error (nano::log::type::snapshot, "Snapshot chunk {} of range {} in table {} is corrupt: {}", header.sequence, header.range, header.table, file.string ());
+			return true;
+		}
+	}
+
+	logger.info (nano::log::type::snapshot, "Importing ledger snapshot from: {} ({} chunks)", file.string (), chunks.size ());
+
+	auto current = chunks.begin ();
+	for (uint8_t table = 0; table < tables.size (); ++table)
+	{
+		auto loader = store.bulk_load (tables[table]);
+		uint64_t entries{ 0 };
+		for (; current != chunks.end () && current->header.table == table; ++current)
+		{
+			auto const & header = current->header;
+			bool error = read_chunk (*current) || decode_chunk (bytes, header.entries, [&loader] (auto const & key, auto value) {
+				return loader->put (key, value);
+			});
+			if (error)
+			{
+				logger.error (nano::log::type::snapshot, "Failed loading chunk {} of range {} in table {}", header.sequence, header.range, table);
+				return true;
+			}
+			entries += header.entries;
+		}
+		if (loader->finish ())
+		{
+			logger.error (nano::log::type::snapshot, "Failed to finish loading table {}", table);
+			return true;
+		}
+		logger.info (nano::log::type::snapshot, "Imported table {} of {} ({} entries)", table + 1, tables.size (), entries);
+	}
+
+	if (has_counts)
+	{
+		auto transaction = store.tx_begin_write ({ nano::tables::meta });
+		store.counters.put (transaction, counts);
+	}
+
+	logger.info (nano::log::type::snapshot, "Snapshot import completed");
+	return false;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <nano/store/tables.hpp>
+
+#include <filesystem>
+#include <vector>
+
+namespace nano
+{
+class logger;
+}
+namespace nano::store
+{
+class component;
+}
+
+namespace nano::store
+{
+/**
+ * Exports and imports a consistent copy of the ledger tables in a single backend independent file, used to provision new nodes without a full bootstrap.
+ *
+ * The file starts with a header holding the store version and the persisted ledger counters, followed by checksummed chunks of raw entries.
+ * Each chunk belongs to one key range of one table and stores its keys prefix compressed, so chunks can be produced and verified independently.
+ * Tables are split into key ranges by the first key byte, which lets the export read ranges in parallel while the import still loads every table in key order.
+ */
+class snapshot final
+{
+public:
+	snapshot (nano::store::component &, nano::logger &);
+
+	/**
+	 * Writes all ledger tables to `file`, reading up to `threads` key ranges concurrently.
+	 * Writes to the exported tables are blocked for the duration of the export.
+	 * @return true on error
+	 */
+	bool export_to (std::filesystem::path const & file, unsigned threads);
+
+	/**
+	 * Loads a snapshot created by `export_to` into empty ledger tables of a store with the same version
+	 * @return true on error
+	 */
+	bool import_from (std::filesystem::path const & file);
+
+public:
+	/** Tables included in a snapshot, node local data such as peers and online weight samples is left out */
+	static std::vector<nano::tables> const tables;
+	static unsigned constexpr ranges{ 16 };
+	static uint32_t constexpr format_version{ 1 };
+	/** Approximate uncompressed size of each chunk */
+	static std::size_t constexpr chunk_size{ 4 * 1024 * 1024 };
+
+private:
+	nano::store::component & store;
+	nano::logger & logger;
+};
+}
@@ -0,0 +1 @@
+#include <nano/store/unconfirmed.hpp>
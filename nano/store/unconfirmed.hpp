@@ -0,0 +1,27 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/iterator.hpp>
+
+#include <functional>
+
+namespace nano::store
+{
+/**
+ * Manages the index of accounts that have unconfirmed blocks, i.e. whose confirmation height is below their block count
+ */
+class unconfirmed
+{
+public:
+	virtual void put (store::write_transaction const & transaction_a, nano::account const & account_a) = 0;
+	virtual void del (store::write_transaction const & transaction_a, nano::account const & account_a) = 0;
+	virtual bool exists (store::transaction const & transaction_a, nano::account const & account_a) const = 0;
+	virtual size_t count (store::transaction const & transaction_a) const = 0;
+	virtual void clear (store::write_transaction const &) = 0;
+	virtual store::iterator<nano::account, std::nullptr_t> begin (store::transaction const & transaction_a, nano::account const & account_a) const = 0;
+	virtual store::iterator<nano::account, std::nullptr_t> begin (store::transaction const & transaction_a) const = 0;
+	virtual store::iterator<nano::account, std::nullptr_t> end () const = 0;
+	virtual void for_each_par (std::function<void (store::read_transaction const &, store::iterator<nano::account, std::nullptr_t>, store::iterator<nano::account, std::nullptr_t>)> const & action_a) const = 0;
+};
+} // namespace nano::store
@@ -68,7 +68,7 @@ nano::account nano::test::random_account ()
 
 bool nano::test::process (nano::node & node, std::vector<std::shared_ptr<nano::block>> blocks)
 {
-	auto const transaction = node.ledger.tx_begin_write ({ tables::accounts, tables::blocks, tables::pending, tables::rep_weights });
+	auto const transaction = node.ledger.tx_begin_write ({ tables::accounts, tables::blocks, tables::meta, tables::pending, tables::rep_weights, tables::unconfirmed });
 	for (auto & block : blocks)
 	{
 		auto result = node.process (transaction, block);